@@ -0,0 +1,215 @@
+// This file was automatically generated by /supp/autogen.
+
+	#include "../funcbench.h"
+
+	const std::vector<FunctionBenchCase> &functionBenchCases() {
+		static const std::vector<FunctionBenchCase> result = {
+			{0, "worldPos()", false, {WGA_Value::Dimensionality::D3D}},
+{1, "select(Bool, Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{2, "select(Bool, Float2, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{3, "select(Bool, Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{4, "select(Bool, Bool, Bool)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{5, "select(Bool, Block, Block)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{6, "select(Bool, Rule, Rule)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{7, "select(Bool, ComponentNode, ComponentNode)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{8, "float2(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{9, "float2(Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{10, "float3(Float, Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{11, "float3(Float2, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{12, "float3(Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{13, "x(Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{14, "x(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{15, "y(Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{16, "y(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{17, "z(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{18, "xy(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{19, "normalize(Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{20, "normalize(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{21, "length(Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{22, "length(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{23, "lengthExp(Float2, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{24, "lengthExp(Float3, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{25, "manhattanLength(Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{26, "manhattanLength(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{27, "distance(Float2, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{28, "distance(Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{29, "manhattanDistance(Float2, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{30, "manhattanDistance(Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{31, "distanceTo(Float3)", false, {WGA_Value::Dimensionality::D3D}},
+{32, "distanceTo(Float2)", false, {WGA_Value::Dimensionality::D2D}},
+{33, "distanceTo2D(Float3)", false, {WGA_Value::Dimensionality::D2D}},
+{34, "distanceToLine(Float3, Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{35, "sampleOffset(Float, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{36, "sampleOffset(Float2, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{37, "sampleOffset(Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{38, "sampleOffset(Bool, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{39, "sampleOffset(Block, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{40, "sampleOffset(Rule, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{41, "sampleOffset(ComponentNode, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{42, "sampleAt(Float, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{43, "sampleAt(Float2, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{44, "sampleAt(Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{45, "sampleAt(Bool, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{46, "sampleAt(Block, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{47, "sampleAt(Rule, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{48, "sampleAt(ComponentNode, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{49, "sampleAt(Float, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{50, "sampleAt(Float2, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{51, "sampleAt(Float3, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{52, "sampleAt(Bool, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{53, "sampleAt(Block, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{54, "sampleAt(Rule, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{55, "sampleAt(ComponentNode, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{56, "sampleGradient2D(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{57, "sampleAvg2D(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{58, "sampleAvg2D(Float2, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{59, "sampleAvg2D(Float3, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{60, "biomeParam_nearest(Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{61, "biomeParam_nearest(Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{62, "biomeParam_nearest(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{63, "biomeParam_nearest(Bool)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{64, "biomeParam_nearest(Block)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{65, "biomeParam_nearest(Rule)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{66, "biomeParam_nearest(ComponentNode)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{67, "biomeParam_nearestSet(Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{68, "biomeParam_nearestSet(Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{69, "biomeParam_nearestSet(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{70, "biomeParam_nearestSet(Bool)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{71, "biomeParam_nearestSet(Block)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{72, "biomeParam_nearestSet(Rule)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{73, "biomeParam_nearestSet(ComponentNode)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{74, "biomeParam_weighted(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{75, "biomeParam_weighted(Float2, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{76, "biomeParam_weighted(Float3, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{77, "spawn2D(Rule, Float, Float, Float, Bool)", false, {WGA_Value::Dimensionality::D3D}},
+{78, "worldPos(ComponentNode)", true, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{79, "worldPos(Float3)", true, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{80, "localPos()", true, {WGA_Value::Dimensionality::D3D}},
+{81, "localPos(Float3)", true, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{82, "localSeed()", true, {}},
+{83, "distanceTo(ComponentNode)", true, {WGA_Value::Dimensionality::D3D}},
+{84, "sampleAt(Float, ComponentNode)", true, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{85, "sampleAt(Float2, ComponentNode)", true, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{86, "sampleAt(Float3, ComponentNode)", true, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{87, "sampleAt(Bool, ComponentNode)", true, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{88, "sampleAt(Block, ComponentNode)", true, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{89, "sampleAt(Rule, ComponentNode)", true, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{90, "sampleAt(ComponentNode, ComponentNode)", true, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{91, "randC(Float)", false, {}},
+{92, "randL(Float)", true, {}},
+{93, "randPC(Float)", false, {}},
+{94, "rand2D(Float)", false, {WGA_Value::Dimensionality::D2D}},
+{95, "rand3D(Float)", false, {WGA_Value::Dimensionality::D3D}},
+{96, "valueNoisePC(Float, Float, Float)", false, {}},
+{97, "valueNoise2D(Float, Float, Float)", false, {WGA_Value::Dimensionality::D2D}},
+{98, "perlin2D(Float, Float)", false, {WGA_Value::Dimensionality::D2D}},
+{99, "perlin3D(Float, Float)", false, {WGA_Value::Dimensionality::D3D}},
+{100, "voronoi2D(Float, Float, Float, Float)", false, {WGA_Value::Dimensionality::D2D}},
+{101, "voronoi2DColored(Float, Float, Float, Float, Float)", false, {WGA_Value::Dimensionality::D2D}},
+{102, "poissonDisc2DBool(Float, Float)", false, {WGA_Value::Dimensionality::D2D}},
+{103, "osimplex2D(Float, Float)", false, {WGA_Value::Dimensionality::D2D}},
+{104, "osimplex3D(Float, Float)", false, {WGA_Value::Dimensionality::D3D}},
+{105, "minPC(Float)", false, {}},
+{106, "maxPC(Float)", false, {}},
+{107, "min(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{108, "min(Float2, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{109, "min(Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{110, "max(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{111, "max(Float2, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{112, "max(Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{113, "smoothMin(Float, Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{114, "smoothMax(Float, Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{115, "clamp(Float, Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{116, "clamp(Float2, Float2, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{117, "clamp(Float3, Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{118, "clamp01(Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{119, "clamp01(Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{120, "clamp01(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{121, "mix(Float, Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{122, "mix(Float2, Float2, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{123, "mix(Float3, Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{124, "abs(Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{125, "abs(Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{126, "abs(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{127, "floor(Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{128, "floor(Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{129, "floor(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{130, "ceil(Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{131, "ceil(Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{132, "ceil(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{133, "round(Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{134, "round(Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{135, "round(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{136, "fract(Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{137, "fract(Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{138, "fract(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{139, "ffract(Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{140, "ffract(Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{141, "ffract(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{142, "pow(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{143, "sin(Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{144, "cos(Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{145, "inverse(Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{146, "inverse(Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{147, "inverse(Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{148, "add(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{149, "add(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{150, "add(Float2, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{151, "add(Float2, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{152, "add(Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{153, "add(Float3, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{154, "sub(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{155, "sub(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{156, "sub(Float2, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{157, "sub(Float2, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{158, "sub(Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{159, "sub(Float3, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{160, "mult(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{161, "mult(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{162, "mult(Float2, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{163, "mult(Float2, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{164, "mult(Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{165, "mult(Float3, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{166, "div(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{167, "div(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{168, "div(Float2, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{169, "div(Float2, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{170, "div(Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{171, "div(Float3, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{172, "mod(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{173, "mod(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{174, "mod(Float2, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{175, "mod(Float2, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{176, "mod(Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{177, "mod(Float3, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{178, "logOr(Bool, Bool)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{179, "logAnd(Bool, Bool)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{180, "logNot(Bool)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{181, "bool(Block)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{182, "compEq(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{183, "compEq(Float2, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{184, "compEq(Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{185, "compEq(Bool, Bool)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{186, "compEq(Block, Block)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{187, "compEq(Rule, Rule)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{188, "compEq(ComponentNode, ComponentNode)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{189, "compEq(Float2, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{190, "compEq(Float3, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{191, "compNeq(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{192, "compNeq(Float2, Float2)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{193, "compNeq(Float3, Float3)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{194, "compNeq(Bool, Bool)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{195, "compNeq(Block, Block)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{196, "compNeq(Rule, Rule)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{197, "compNeq(ComponentNode, ComponentNode)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{198, "compNeq(Float2, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{199, "compNeq(Float3, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{200, "compLt(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{201, "compGt(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{202, "compLeq(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+{203, "compGeq(Float, Float)", false, {WGA_Value::Dimensionality::D2D, WGA_Value::Dimensionality::D3D}},
+
+		};
+		return result;
+	}
+	
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include "funcbench.h"
+
+#include <chrono>
+#include <format>
+
+#include "worldgen/cpu/worldgenapi_cpu.h"
+#include "worldgen/cpu/supp/wga_valuewrapper_cpu.h"
+
+namespace {
+
+	using Dimensionality = WGA_Value::Dimensionality;
+	using ValueType = WGA_Value::ValueType;
+
+	WGA_Value *callFunction(WorldGenAPI_CPU &api, const std::string &prototype, const WorldGenAPI::FunctionArgs &args) {
+		const auto &mapping = WorldGenAPI::functions().prototypeMapping;
+		const auto it = mapping.find(prototype);
+		if(it == mapping.end())
+			throw std::exception(std::format("Function '{}' does not exist.", prototype).c_str());
+
+		return api.function(it->second, args);
+	}
+
+	/// Creates a synthetic (random) input of the given type and dimensionality or returns nullptr if the type cannot be synthesized.
+	/// Different seeds give different inputs.
+	WGA_Value *syntheticInput(WorldGenAPI_CPU &api, ValueType type, Dimensionality dim, float seed) {
+		const auto rand = [&](float s) {
+			return callFunction(api, dim == Dimensionality::D2D ? "rand2D(Float)" : "rand3D(Float)", {api.constFloat(s)});
+		};
+
+		switch(type) {
+
+			case ValueType::Float:
+				return rand(seed);
+
+			case ValueType::Float2:
+				return callFunction(api, "float2(Float, Float)", {rand(seed), rand(seed + 0.5f)});
+
+			case ValueType::Float3:
+				return callFunction(api, "float3(Float, Float, Float)", {rand(seed), rand(seed + 0.25f), rand(seed + 0.5f)});
+
+			case ValueType::Bool:
+				return callFunction(api, "compLt(Float, Float)", {rand(seed), api.constFloat(0.5f)});
+
+			case ValueType::Block:
+				return callFunction(api, "select(Bool, Block, Block)", {syntheticInput(api, ValueType::Bool, dim, seed), api.constBlock(blockID_air), api.constBlock(blockID_undefined)});
+
+			default:
+				return nullptr;
+
+		}
+	}
+
+	/// Makes sure the value record for the origin is generated
+	void generate(WGA_Value *v, const BlockWorldPos &origin) {
+		switch(v->valueType()) {
+
+#define I(A, name) case ValueType::name: WGA_ValueWrapper_CPU<ValueType::name>(v).dataHandle(origin); break;
+			WGA_TYPES(I, _)
+#undef I
+
+			default:
+				throw std::exception("Unsupported value type.");
+
+		}
+	}
+
+	std::string benchmarkCase(const FunctionBenchCase &c, Dimensionality dim, size_t chunkCount) {
+		const std::string dimName = dim == Dimensionality::D2D ? "2D" : "3D";
+		const auto resultJSON = [&](const std::string &fields) {
+			return std::format("{{\"function\": \"{}\", \"dim\": \"{}\", {}}}", c.prototype, dimName, fields);
+		};
+
+		const WorldGenAPI::Function &f = WorldGenAPI::functions().list[c.functionID];
+
+		// Fresh API for each case so that the cases don't affect each other
+		WorldGenAPI_CPU api;
+		api.setSeed(WorldGenSeed(0));
+
+		// Biome functions need at least one biome to exist
+		api.newBiome();
+
+		WorldGenAPI::FunctionArgs args;
+		for(size_t i = 0; i < f.arguments.size(); i++) {
+			WGA_Value *arg = syntheticInput(api, f.arguments[i].type, dim, static_cast<float>(i + 1));
+			if(!arg)
+				return resultJSON(std::format("\"skipped\": \"cannot synthesize {} argument\"", WGA_Value::typeNames.at(f.arguments[i].type)));
+
+			args.push_back(arg);
+		}
+
+		WGA_Value *result = api.function(c.functionID, args);
+		if(result->dimensionality() != dim)
+			return resultJSON("\"skipped\": \"result has different dimensionality\"");
+
+		std::vector<BlockWorldPos> origins;
+		for(size_t i = 0; i < chunkCount; i++)
+			origins.push_back(BlockWorldPos(static_cast<BlockWorldPos_T>(i), 0, 0) * chunkSize);
+
+		// Generate the inputs beforehand, so that only the function fill is measured
+		for(WGA_Value *arg: args) {
+			for(const BlockWorldPos &origin: origins)
+				generate(arg, origin);
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		for(const BlockWorldPos &origin: origins)
+			generate(result, origin);
+
+		const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+		const size_t voxelCount = chunkCount * (dim == Dimensionality::D2D ? chunkSurface : chunkVolume);
+
+		return resultJSON(std::format("\"records\": {}, \"usPerRecord\": {}, \"nsPerVoxel\": {}", chunkCount, ns / chunkCount / 1000, ns / voxelCount));
+	}
+
+}
+
+std::string runFunctionBenchmarks(const std::string &filter, size_t chunkCount) {
+	std::string result = "[\n";
+	bool isFirst = true;
+
+	for(const FunctionBenchCase &c: functionBenchCases()) {
+		if(c.isContextual || std::string(c.prototype).find(filter) == std::string::npos)
+			continue;
+
+		for(Dimensionality dim: c.dimensionalities) {
+			std::string caseResult;
+			try {
+				caseResult = benchmarkCase(c, dim, chunkCount);
+			}
+			catch(const std::exception &e) {
+				caseResult = std::format("{{\"function\": \"{}\", \"error\": \"{}\"}}", c.prototype, e.what());
+			}
+
+			result += std::format("{}\t{}", isFirst ? "" : ",\n", caseResult);
+			isFirst = false;
+		}
+	}
+
+	result += "\n]";
+	return result;
+}
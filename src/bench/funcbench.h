@@ -0,0 +1,25 @@
+#pragma once
+
+#include <vector>
+#include <string>
+
+#include "worldgen/base/worldgenapi.h"
+
+/// Microbenchmark case of a single WOGLAC function overload
+struct FunctionBenchCase {
+	WorldGenAPI::FunctionID functionID;
+	const char *prototype;
+
+	/// Contextual functions need a structure generation context, they are not benchmarked
+	bool isContextual;
+
+	/// Dimensionalities the function is benchmarked in (records are filled with synthetic inputs of that dimensionality)
+	std::vector<WGA_Value::Dimensionality> dimensionalities;
+};
+
+/// Generated by /supp/autogen from functions.yaml
+const std::vector<FunctionBenchCase> &functionBenchCases();
+
+/// Measures record fill time of all cases with prototypes containing the filter, generating chunkCount records per case.
+/// Returns the results as a JSON array.
+std::string runFunctionBenchmarks(const std::string &filter, size_t chunkCount);
@@ -0,0 +1,458 @@
+#include <mutex>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <format>
+#include <string>
+#include <deque>
+#include <filesystem>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+
+#ifdef _WINDOWS
+
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+
+#else
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#endif
+
+#include "worldgen/base/worldgenapi.h"
+#include "worldgen/cpu/worldgenapi_cpu.h"
+#include "worldgen/cpu/supp/wga_valuewrapper_cpu.h"
+#include "woglac/wglcompiler.h"
+
+#include "funcbench.h"
+
+// Benchmark harness for the worldgen pipeline. Generates a region of chunks of an export (the same way main.cpp does for the getData command)
+// with different thread counts, both with a cold and with a warm cache, and prints the results as JSON.
+
+using Clock = std::chrono::steady_clock;
+using CacheType = WGA_DataCache_CPU::CacheType;
+
+struct RunResult {
+	std::string cache;
+	size_t threadCount = 0;
+	double seconds = 0;
+	std::vector<double> latencies; ///< Per chunk, in milliseconds
+	WGA_DataCache_CPU::Stats cacheStats[+CacheType::_count];
+	size_t rss = 0; ///< Resident set size after the run
+};
+
+/// Current resident set size of the process in bytes (0 if not available)
+size_t currentRSS() {
+#ifdef _WINDOWS
+	PROCESS_MEMORY_COUNTERS pmc;
+	if(!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+		return 0;
+
+	return pmc.WorkingSetSize;
+#else
+	// Second field of statm is the resident page count
+	std::ifstream f("/proc/self/statm");
+	size_t size = 0, resident = 0;
+	if(!(f >> size >> resident))
+		return 0;
+
+	return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+/// Peak resident set size of the process over its whole lifetime in bytes (0 if not available)
+size_t processPeakRSS() {
+#ifdef _WINDOWS
+	PROCESS_MEMORY_COUNTERS pmc;
+	if(!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+		return 0;
+
+	return pmc.PeakWorkingSetSize;
+#else
+	rusage usage;
+	if(getrusage(RUSAGE_SELF, &usage))
+		return 0;
+
+	return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+}
+
+/// Generates chunks of the export using threadCount threads, returns the run results
+RunResult benchmarkRun(WorldGenAPI_CPU &wgapi, WGA_Value *val, const std::vector<BlockWorldPos> &chunks, size_t threadCount) {
+	// Jobs scheduled by the worldgen (helping with the parallel generation); idle (prefetch) jobs are dropped so that the runs are reproducible
+	std::mutex jobsMutex;
+	std::deque<WorldGenAPI_CPU::Job> jobs;
+
+	wgapi.setJobScheduler([&](WorldGenAPI_CPU::Job &&job, WorldGenAPI_CPU::JobPriority priority) {
+		if(priority != WorldGenAPI_CPU::JobPriority::Urgent)
+			return;
+
+		std::unique_lock _ml(jobsMutex);
+		jobs.push_back(std::move(job));
+	}, threadCount);
+
+	std::function<void(const BlockWorldPos &)> generate;
+	if(val->valueType() == WGA_Value::ValueType::Float)
+		generate = [val](const BlockWorldPos &pos) { WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>(val).dataHandle(pos); };
+
+	else if(val->valueType() == WGA_Value::ValueType::Block)
+		generate = [val](const BlockWorldPos &pos) { WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>(val).dataHandle(pos); };
+
+	else
+		throw std::exception(std::format("Unsupported export value type: {}", WGA_Value::typeNames.at(val->valueType())).c_str());
+
+	RunResult result;
+	result.threadCount = threadCount;
+	result.latencies.resize(chunks.size());
+
+	WGA_DataCache_CPU::Stats statsBefore[+CacheType::_count];
+	for(int i = 0; i < +CacheType::_count; i++)
+		statsBefore[i] = wgapi.dataCache().stats(static_cast<CacheType>(i));
+
+	std::atomic<size_t> nextChunk = 0;
+	std::mutex exceptionMutex;
+	std::exception_ptr exception;
+
+	const auto worker = [&] {
+		WorldGenAPI_CPU::createLocalCache();
+
+		try {
+			while(true) {
+				WorldGenAPI_CPU::Job job;
+				{
+					std::unique_lock _ml(jobsMutex);
+					if(!jobs.empty()) {
+						job = std::move(jobs.front());
+						jobs.pop_front();
+					}
+				}
+
+				if(job) {
+					job();
+					continue;
+				}
+
+				const size_t i = nextChunk++;
+				if(i >= chunks.size())
+					break;
+
+				const auto start = Clock::now();
+				generate(chunks[i]);
+				result.latencies[i] = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+			}
+		}
+		catch(...) {
+			std::unique_lock _ml(exceptionMutex);
+			if(!exception)
+				exception = std::current_exception();
+		}
+
+		WorldGenAPI_CPU::destroyLocalCache();
+	};
+
+	const auto start = Clock::now();
+	{
+		std::vector<std::thread> pool;
+		for(size_t i = 0; i < threadCount; i++)
+			pool.push_back(std::thread(worker));
+
+		for(std::thread &t: pool)
+			t.join();
+	}
+	result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+	// Jobs left in the queue are helpers that came too late, they would not do anything anymore
+	jobs.clear();
+	wgapi.setJobScheduler({}, 0);
+
+	if(exception)
+		std::rethrow_exception(exception);
+
+	for(int i = 0; i < +CacheType::_count; i++) {
+		const auto stats = wgapi.dataCache().stats(static_cast<CacheType>(i));
+		result.cacheStats[i].hitCount = stats.hitCount - statsBefore[i].hitCount;
+		result.cacheStats[i].missCount = stats.missCount - statsBefore[i].missCount;
+	}
+
+	result.rss = currentRSS();
+
+	return result;
+}
+
+std::string runResultJSON(RunResult &r, size_t chunkCount) {
+	std::sort(r.latencies.begin(), r.latencies.end());
+	const auto percentile = [&](double p) {
+		return r.latencies.empty() ? 0 : r.latencies[std::min(r.latencies.size() - 1, static_cast<size_t>(p * r.latencies.size()))];
+	};
+
+	std::string hitRates;
+	for(int i = 0; i < +CacheType::_count; i++) {
+		const auto &s = r.cacheStats[i];
+		const size_t total = s.hitCount + s.missCount;
+		hitRates += std::format(
+			"{}\"{}\": {{\"hits\": {}, \"misses\": {}, \"hitRate\": {}}}",
+			i ? ", " : "", WGA_DataCache_CPU::cacheTypeNames[i], s.hitCount, s.missCount, total ? static_cast<double>(s.hitCount) / total : 0.0
+		);
+	}
+
+	return std::format(
+		"{{\"cache\": \"{}\", \"threads\": {}, \"seconds\": {}, \"chunksPerSecond\": {}, \"latencyP50Ms\": {}, \"latencyP99Ms\": {}, \"cacheHitRates\": {{{}}}, \"rssBytes\": {}}}",
+		r.cache, r.threadCount, r.seconds, r.seconds > 0 ? chunkCount / r.seconds : 0.0, percentile(0.5), percentile(0.99), hitRates, r.rss
+	);
+}
+
+int main(int argc, char *argv[]) {
+	try {
+		std::vector<std::string> files, lookupDirs;
+		std::string programCache, exportName, outputFile;
+		std::unordered_map<std::string, BlockID> blockMapping;
+		std::vector<size_t> threadCounts;
+		size_t seed = 0;
+		int radius = 4, layers = 4, zOffset = 0;
+		bool functionBench = false;
+		std::string functionFilter;
+		size_t functionBenchRecords = 64;
+		bool showHelp = argc < 2;
+
+		size_t argi = 1;
+		const auto popArg = [&](const std::string &def = {}) {
+			return (argi >= argc) ? def : std::string(argv[argi++]);
+		};
+
+		while(argi < argc) {
+			const std::string arg = popArg();
+			if(arg == "-f" || arg == "--sourceFile")
+				files.push_back(popArg());
+
+			else if(arg == "-d" || arg == "--lookupDirectory")
+				lookupDirs.push_back(popArg());
+
+			else if(arg == "-s" || arg == "--seed")
+				seed = std::stoull(popArg());
+
+			else if(arg == "-m" || arg == "--blockMapping") {
+				const std::string str = popArg();
+				size_t offset = 0;
+				while(true) {
+					const size_t eqsep = str.find('=', offset);
+					if(eqsep == std::string::npos)
+						break;
+
+					const size_t endsep = str.find(',', eqsep);
+
+					const std::string uid = str.substr(offset, eqsep - offset);
+					const BlockID id = (BlockID) std::stoi(str.substr(eqsep + 1, endsep));
+
+					blockMapping.insert_or_assign(uid, id);
+
+					if(endsep == std::string::npos)
+						break;
+
+					offset = endsep + 1;
+				}
+			}
+
+			else if(arg == "-c" || arg == "--programCache")
+				programCache = popArg();
+
+			else if(arg == "-e" || arg == "--export")
+				exportName = popArg();
+
+			else if(arg == "-r" || arg == "--radius")
+				radius = std::stoi(popArg());
+
+			else if(arg == "-l" || arg == "--layers")
+				layers = std::stoi(popArg());
+
+			else if(arg == "-z" || arg == "--zOffset")
+				zOffset = std::stoi(popArg());
+
+			else if(arg == "-t" || arg == "--threadCount")
+				threadCounts.push_back(std::stoull(popArg()));
+
+			else if(arg == "-o" || arg == "--output")
+				outputFile = popArg();
+
+			else if(arg == "--functionBench")
+				functionBench = true;
+
+			else if(arg == "--functionFilter")
+				functionFilter = popArg();
+
+			else if(arg == "--functionBenchRecords")
+				functionBenchRecords = std::stoull(popArg());
+
+			else if(arg == "--help" || arg == "-h")
+				showHelp = true;
+
+			else {
+				std::cout << std::format("Unknown parameter '{}'.\n", arg);
+				return 1;
+			}
+		}
+
+		if(showHelp) {
+			std::cout << R"#(AnotherCraft worldgen benchmark. Generates a region of chunks of an export, first with a cold and then with a warm cache, for each thread count, and prints the results as JSON.
+Usage: ac-worldgen-bench (args)
+
+-f <f> | --sourceFile <f>
+Source file (accepts multiple). If relative path is provided, it is looked for in lookup directories.
+
+-d <d> | --lookupDirectory <d>
+Lookup directory for resources (for .vox, .woglac files).
+
+-s <s> | --seed <s>
+Seed for the worldgen (number).
+
+-m <m> | --blockMapping <m>
+Block UID (string) -> ID (uint16_t) mapping in format 'uid=id,uid2=id2,uid3=id3' (see ac-worldgen --help).
+
+-c <f> | --programCache <f>
+Precompiled program file (see ac-worldgen --help).
+
+-e <e> | --export <e>
+Export to generate (Float or Block). Required.
+
+-r <r> | --radius <r>
+Generates chunks columns in the square [-r, r] (in chunks) around the origin. Default 4.
+
+-l <l> | --layers <l>
+Number of chunk layers per chunk column. Default 4.
+
+-z <z> | --zOffset <z>
+Z of the lowest generated chunk layer (in chunks). Default 0.
+
+-t <t> | --threadCount <t>
+Thread count to benchmark with (accepts multiple). Default 1 and the hardware concurrency.
+
+-o <f> | --output <f>
+File to write the JSON results to. Default stdout.
+
+--functionBench
+Instead of generating a region, measures record fill time of each WOGLAC function for 2D and 3D records with synthetic inputs (no source files needed).
+
+--functionFilter <f>
+Only benchmark functions with prototypes containing the string (for example 'perlin2D').
+
+--functionBenchRecords <n>
+Number of records generated per function benchmark. Default 64.
+			)#";
+			return 0;
+		}
+
+		const auto writeOutput = [&](const std::string &json) {
+			if(outputFile.empty()) {
+				std::cout << json;
+				return;
+			}
+
+			std::ofstream f(outputFile, std::ios::out | std::ios::binary);
+			if(!f.good())
+				throw std::exception(std::format("Could not open file '{}' for writing.", outputFile).c_str());
+
+			f << json;
+		};
+
+		if(functionBench) {
+			writeOutput(std::format("{{\"functions\": {}}}\n", runFunctionBenchmarks(functionFilter, functionBenchRecords)));
+			return 0;
+		}
+
+		if(exportName.empty())
+			throw std::exception("No export specified (-e).");
+
+		if(threadCounts.empty())
+			threadCounts = {1, std::max<size_t>(1, std::thread::hardware_concurrency())};
+
+		const auto lookupFile = [&](const std::string &filename) {
+			// Absolute filepath -> no need to lookup
+			if(std::filesystem::path(filename).is_absolute())
+				return filename;
+
+			for(const std::string &dirn: lookupDirs) {
+				const std::string filePath = dirn + "/" + filename;
+				if(std::ifstream f(filePath); f.good())
+					return filePath;
+			}
+
+			throw std::exception(std::format("Failed to lookup file '{}'.", filename).c_str());
+		};
+
+		WGLCompiler wgc;
+		wgc.setStreamFunction([&](const std::string &filename) {
+			std::string file = lookupFile(filename);
+
+			auto f = std::make_unique<std::ifstream>();
+			f->open(file, std::ios::in | std::ios::binary);
+
+			if(!f->good())
+				throw std::exception(std::format("Could not open file '{}' for reading.", file).c_str());
+
+			return f;
+		});
+
+		for(const std::string &filename: files)
+			wgc.addSourceFile(filename);
+
+		const auto compileStart = Clock::now();
+		const bool isProgramLoaded = !programCache.empty() && wgc.loadProgram(programCache);
+		if(!isProgramLoaded)
+			wgc.compile();
+
+		const double compileSeconds = std::chrono::duration<double>(Clock::now() - compileStart).count();
+
+		// Chunks in the column order, so that the structures and 2D data are shared the same way as when a client requests whole columns
+		std::vector<BlockWorldPos> chunks;
+		for(int y = -radius; y <= radius; y++) {
+			for(int x = -radius; x <= radius; x++) {
+				for(int z = 0; z < layers; z++)
+					chunks.push_back(BlockWorldPos(x, y, z + zOffset) * chunkSize);
+			}
+		}
+
+		std::vector<std::string> runs;
+		for(size_t threadCount: threadCounts) {
+			// Fresh API for each thread count -> cold cache
+			WorldGenAPI_CPU wgapi;
+			wgapi.setSeed(WorldGenSeed(seed));
+
+			blockMapping["block.air"] = blockID_air;
+			blockMapping["block.undefined"] = blockID_undefined;
+			wgapi.setBlockUIDMapping(blockMapping);
+
+			const auto exports = wgc.construct(wgapi);
+			const auto valp = exports.find(exportName);
+			if(valp == exports.end())
+				throw std::exception(std::format("Export does not exist: {}", exportName).c_str());
+
+			for(const char *cache: {"cold", "warm"}) {
+				RunResult r = benchmarkRun(wgapi, valp->second, chunks, threadCount);
+				r.cache = cache;
+				runs.push_back(runResultJSON(r, chunks.size()));
+			}
+		}
+
+		std::string json = std::format(
+			"{{\"export\": \"{}\", \"seed\": {}, \"chunkCount\": {}, \"compileSeconds\": {}, \"programLoaded\": {}, \"processPeakRSSBytes\": {}, \"runs\": [\n",
+			exportName, seed, chunks.size(), compileSeconds, isProgramLoaded, processPeakRSS()
+		);
+		for(size_t i = 0; i < runs.size(); i++)
+			json += std::format("\t{}{}\n", runs[i], i + 1 < runs.size() ? "," : "");
+
+		json += "]}\n";
+
+		writeOutput(json);
+	}
+	catch(const std::exception &e) {
+		std::cerr << e.what() << "\n";
+		return 1;
+	}
+
+	return 0;
+}
@@ -5,6 +5,7 @@ class WorldGenAPI;
 class WGLCompiler;
 class WGLContext;
 class WGLModule;
+class WGLProgram;
 
 class WGA_Biome;
 class WGA_Value;
@@ -16,9 +17,11 @@ class WGA_Symbol;
 
 class WorldGenAPI_CPU;
 
+class WGA_Value_CPU;
 class WGA_DataCache_CPU;
 class WGA_StructureGenerator_CPU;
 class WGA_BiomeData_CPU;
+struct WGA_BiomeGridCell_CPU;
 
 namespace antlr4 {
 	class ParserRuleContext;
@@ -5,8 +5,10 @@
 #include <unordered_map>
 #include <format>
 #include <string>
-#include <queue>
+#include <deque>
 #include <filesystem>
+#include <chrono>
+#include <atomic>
 
 #ifdef _WINDOWS
 
@@ -18,6 +20,7 @@
 #include "util/forit.h"
 #include "util/iterators.h"
 #include "util/tracyutils.h"
+#include "util/scopeexit.h"
 #include "worldgen/base/worldgenapi.h"
 #include "worldgen/cpu/worldgenapi_cpu.h"
 #include "worldgen/cpu/supp/wga_valuewrapper_cpu.h"
@@ -28,9 +31,21 @@ std::mutex stdoutMutex;
 
 TracyLockable(std::mutex, jobsMutex);
 std::condition_variable_any jobEndCondition, newJobCondition;
-std::queue<std::function<void()>> jobs;
+std::deque<std::function<void()>> jobs;
 size_t runningJobs = 0;
 
+/// Jobs that are only run when there are no other jobs (not counted in runningJobs)
+std::deque<std::function<void()>> idleJobs;
+size_t runningIdleJobs = 0; ///< Idle jobs picked up by the workers and not finished yet
+constexpr size_t maxIdleJobs = 1024;
+
+/// Worker statistics (for the stats command)
+std::atomic<size_t> busyWorkers = 0;
+std::atomic<uint64_t> workerBusyTime = 0; ///< Cumulative time spent running jobs, in nanoseconds
+
+/// Number of the most time consuming symbols listed in the stats
+constexpr size_t statsSymbolCount = 32;
+
 int main(int argc, char *argv[]) {
 #ifdef _WINDOWS
 	// Set stdout mode to binary to prevent unwanted \n -> \r\n in binary data
@@ -41,9 +56,11 @@ int main(int argc, char *argv[]) {
 
 	try {
 		std::vector<std::string> files, lookupDirs;
+		std::string programCache;
 		std::unordered_map<std::string, BlockID> blockMapping;
 		size_t seed = 0;
 		size_t threadCount = std::min<size_t>(std::thread::hardware_concurrency() - 2, 4);
+		size_t statsInterval = 0;
 		bool exportList = false;
 		bool showHelp = argc < 2;
 
@@ -85,9 +102,15 @@ int main(int argc, char *argv[]) {
 				}
 			}
 
+			else if(arg == "-c" || arg == "--programCache")
+				programCache = popArg();
+
 			else if(arg == "-t" || arg == "--threadCount")
 				threadCount = stoi(popArg());
 
+			else if(arg == "--statsInterval")
+				statsInterval = std::stoull(popArg());
+
 			else if(arg == "--functionList") {
 				std::cout << "# WOGLAC function list\n";
 				std::cout << "Auto generated from the source code.\n\n";
@@ -127,6 +150,12 @@ Block UIDs have to be prefixed with 'block.', for example 'block.core.air'.
 ID 0 is reserved for 'block.air'.
 ID 1 is reserved for 'block.undefined'.
 
+-c <f> | --programCache <f>
+Precompiled program file. If the file exists and is up to date with the source files, it is loaded instead of compiling the sources. Otherwise, the sources are compiled and the program is saved to the file.
+
+--statsInterval <s>
+Prints the worldgen statistics (same as the stats command) to stderr every <s> seconds.
+
 --functionList
 Emits a function list in the Markdown format.--exportList
 Compiles the source files and prints out the list of exports.
@@ -143,6 +172,25 @@ Compiles the source files and prints out the list of exports.
 			blockMapping["block.air"] = blockID_air;
 			blockMapping["block.undefined"] = blockID_undefined;
 			wgapi.setBlockUIDMapping(blockMapping);
+
+			wgapi.setJobScheduler([](std::function<void()> &&job, WorldGenAPI_CPU::JobPriority priority) {
+				std::unique_lock _ml(jobsMutex);
+
+				// Urgent jobs are helping with records other jobs are possibly waiting for -> put them at the front of the queue
+				if(priority == WorldGenAPI_CPU::JobPriority::Urgent) {
+					runningJobs++;
+					jobs.push_front(std::move(job));
+				}
+				else {
+					// Idle queue is full -> drop the oldest job, it is the least likely one to be needed
+					if(idleJobs.size() >= maxIdleJobs)
+						idleJobs.pop_front();
+
+					idleJobs.push_back(std::move(job));
+				}
+
+				newJobCondition.notify_one();
+			}, threadCount);
 		}
 
 		const auto lookupFile = [&](const std::string &filename) {
@@ -179,8 +227,20 @@ Compiles the source files and prints out the list of exports.
 			for(const std::string &filename: files)
 				wgc.addSourceFile(filename);
 
-			wgc.compile();
+			if(programCache.empty() || !wgc.loadProgram(programCache))
+				wgc.compile();
+
 			exports = wgc.construct(wgapi);
+
+			// Failing to cache the program is not fatal, it will just be compiled again on the next run
+			if(!programCache.empty() && !wgc.isProgramLoaded()) {
+				try {
+					wgc.saveProgram(programCache);
+				}
+				catch(const std::exception &e) {
+					std::cerr << std::format("Failed to save the WOGLAC program cache '{}': {}\n", programCache, e.what());
+				}
+			}
 		}
 
 		if(exportList) {
@@ -198,16 +258,28 @@ Compiles the source files and prints out the list of exports.
 					std::srand(std::time(0) ^ WorldGen_CPU_Utils::scramble(i));
 
 					std::function<void()> job;
+					bool isIdleJob = false;
 
 					{
 						std::unique_lock lock(jobsMutex);
-						while(jobs.empty())
+						while(jobs.empty() && idleJobs.empty())
 							newJobCondition.wait(lock);
 
-						job = jobs.front();
-						jobs.pop();
+						if(!jobs.empty()) {
+							job = std::move(jobs.front());
+							jobs.pop_front();
+						}
+						else {
+							job = std::move(idleJobs.front());
+							idleJobs.pop_front();
+							runningIdleJobs++;
+							isIdleJob = true;
+						}
 					}
 
+					const auto jobStart = std::chrono::steady_clock::now();
+					busyWorkers++;
+
 					try {
 						job();
 					}
@@ -215,9 +287,19 @@ Compiles the source files and prints out the list of exports.
 						std::cerr << e.what() << "\n";
 					}
 
+					busyWorkers--;
+					workerBusyTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - jobStart).count();
+
+					// Destroy the job before reporting it finished, it can reference the worldgen API
+					job = nullptr;
+
 					{
 						std::unique_lock lock(jobsMutex);
-						runningJobs--;
+						if(isIdleJob)
+							runningIdleJobs--;
+						else
+							runningJobs--;
+
 						jobEndCondition.notify_all();
 					}
 				}
@@ -226,6 +308,100 @@ Compiles the source files and prints out the list of exports.
 			}));
 		}
 
+		// Statistics
+		const auto startTime = std::chrono::steady_clock::now();
+		std::mutex statsMutex;
+
+		/// Utilization is reported since the previous report of the same consumer (stats command, periodic dump)
+		struct StatsWindow {
+			std::chrono::steady_clock::time_point time;
+			uint64_t workerBusyTime = 0;
+		};
+		StatsWindow commandStatsWindow{startTime}, periodicStatsWindow{startTime};
+
+		const auto statsJSON = [&](StatsWindow &window) {
+			const auto jsonString = [](const std::string &str) {
+				std::string result = "\"";
+				for(char c: str) {
+					if(c == '"' || c == '\\')
+						result += '\\';
+
+					if(static_cast<unsigned char>(c) >= 0x20)
+						result += c;
+				}
+				return result + "\"";
+			};
+
+			std::unique_lock _ml(statsMutex);
+			wgapi.reportCacheHitRate();
+
+			const auto now = std::chrono::steady_clock::now();
+			const uint64_t busyTime = workerBusyTime;
+			const double elapsed = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - window.time).count());
+			const double utilization = elapsed > 0 && threadCount ? (busyTime - window.workerBusyTime) / (elapsed * threadCount) : 0;
+			window = StatsWindow{now, busyTime};
+
+			size_t queuedJobs, queuedIdleJobs, pendingJobs;
+			{
+				std::unique_lock _jl(jobsMutex);
+				queuedJobs = jobs.size();
+				queuedIdleJobs = idleJobs.size();
+				pendingJobs = runningJobs;
+			}
+
+			std::string cache;
+			for(int i = 0; i < +WGA_DataCache_CPU::CacheType::_count; i++) {
+				const auto st = wgapi.dataCache().stats(static_cast<WGA_DataCache_CPU::CacheType>(i));
+				cache += std::format(
+					"{}\"{}\": {{\"hits\": {}, \"misses\": {}, \"evictions\": {}, \"records\": {}, \"usedBytes\": {}, \"capacityBytes\": {}}}",
+					i ? ", " : "", WGA_DataCache_CPU::cacheTypeNames[i], st.hitCount, st.missCount, st.evictionCount, st.recordCount, st.usedMemory, st.memoryCapacity
+				);
+			}
+
+			std::string symbols;
+			const auto symbolStats = wgapi.dataCache().symbolStats();
+			for(size_t i = 0; i < std::min(symbolStats.size(), statsSymbolCount); i++) {
+				const auto &[symbol, st] = symbolStats[i];
+				symbols += std::format(
+					"{}{{\"symbol\": {}, \"generations\": {}, \"timeMs\": {}}}",
+					i ? ", " : "", jsonString(symbol->description()), st.generationCount, std::chrono::duration<double, std::milli>(st.generationTime).count()
+				);
+			}
+
+			return std::format(
+				"{{\"uptime\": {}, \"queue\": {{\"jobs\": {}, \"idleJobs\": {}, \"pendingJobs\": {}}}, \"workers\": {{\"count\": {}, \"busy\": {}, \"utilization\": {}, \"busyTime\": {}}}, \"cache\": {{{}}}, \"symbols\": [{}]}}",
+				std::chrono::duration<double>(now - startTime).count(), queuedJobs, queuedIdleJobs, pendingJobs, threadCount, busyWorkers.load(), utilization, std::chrono::duration<double>(std::chrono::nanoseconds(busyTime)).count(), cache, symbols
+			);
+		};
+
+		// Periodic stats dump; the thread uses statsJSON, so it has to be stopped before leaving the scope
+		std::thread statsThread;
+		std::mutex statsThreadMutex;
+		std::condition_variable statsThreadCondition;
+		bool statsThreadQuit = false;
+
+		SCOPE_EXIT(
+			if(statsThread.joinable()) {
+				{
+					std::unique_lock _l(statsThreadMutex);
+					statsThreadQuit = true;
+				}
+				statsThreadCondition.notify_all();
+				statsThread.join();
+			}
+		);
+
+		if(statsInterval) {
+			statsThread = std::thread([&] {
+				std::unique_lock l(statsThreadMutex);
+				while(!statsThreadCondition.wait_for(l, std::chrono::seconds(statsInterval), [&] { return statsThreadQuit; })) {
+					const std::string json = statsJSON(periodicStatsWindow);
+					std::unique_lock _l(stdoutMutex);
+					std::cerr << json << "\n";
+				}
+			});
+		}
+
 		// Main stdin loop
 		while(true) {
 			std::string type;
@@ -315,11 +491,20 @@ Compiles the source files and prints out the list of exports.
 				{
 					std::unique_lock _ml(jobsMutex);
 					runningJobs++;
-					jobs.push(job);
+					jobs.push_back(job);
 					newJobCondition.notify_one();
 				}
 			}
 
+			else if(type == "stats") {
+				const std::string json = statsJSON(commandStatsWindow);
+
+				std::unique_lock _ul(stdoutMutex);
+				std::cout << std::format("stats {}\n", json.size());
+				std::cout.write(json.data(), json.size());
+				std::cout.flush();
+			}
+
 			else
 				throw std::exception(std::format("Unknown message type: {}", type).c_str());
 
@@ -328,7 +513,8 @@ Compiles the source files and prints out the list of exports.
 
 		{
 			std::unique_lock l(jobsMutex);
-			while(runningJobs)
+			idleJobs.clear();
+			while(runningJobs || runningIdleJobs)
 				jobEndCondition.wait(l);
 		}
 
@@ -0,0 +1,98 @@
+#include "mappedfile.h"
+
+#include <format>
+#include <stdexcept>
+
+#ifdef _WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "scopeexit.h"
+
+MappedFile::MappedFile(const std::string &filename) {
+	bool ok = false;
+	SCOPE_EXIT(if(!ok) release());
+
+#ifdef _WINDOWS
+	file_ = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if(file_ == INVALID_HANDLE_VALUE) {
+		file_ = nullptr;
+		throw std::exception(std::format("Could not open file '{}' for mapping.", filename).c_str());
+	}
+
+	LARGE_INTEGER fileSize;
+	if(!GetFileSizeEx(file_, &fileSize))
+		throw std::exception(std::format("Could not get size of file '{}'.", filename).c_str());
+
+	size_ = static_cast<size_t>(fileSize.QuadPart);
+
+	// Mapping an empty file fails
+	if(size_) {
+		mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if(!mapping_)
+			throw std::exception(std::format("Could not map file '{}'.", filename).c_str());
+
+		data_ = static_cast<const uint8_t *>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+		if(!data_)
+			throw std::exception(std::format("Could not map file '{}'.", filename).c_str());
+	}
+#else
+	fd_ = open(filename.c_str(), O_RDONLY);
+	if(fd_ == -1)
+		throw std::exception(std::format("Could not open file '{}' for mapping.", filename).c_str());
+
+	struct stat st;
+	if(fstat(fd_, &st) == -1)
+		throw std::exception(std::format("Could not get size of file '{}'.", filename).c_str());
+
+	size_ = static_cast<size_t>(st.st_size);
+
+	// Mapping an empty file fails
+	if(size_) {
+		void *ptr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+		if(ptr == MAP_FAILED)
+			throw std::exception(std::format("Could not map file '{}'.", filename).c_str());
+
+		data_ = static_cast<const uint8_t *>(ptr);
+	}
+#endif
+
+	ok = true;
+}
+
+MappedFile::~MappedFile() {
+	release();
+}
+
+void MappedFile::release() {
+#ifdef _WINDOWS
+	if(data_)
+		UnmapViewOfFile(data_);
+
+	if(mapping_)
+		CloseHandle(mapping_);
+
+	if(file_)
+		CloseHandle(file_);
+
+	mapping_ = nullptr;
+	file_ = nullptr;
+#else
+	if(data_)
+		munmap(const_cast<uint8_t *>(data_), size_);
+
+	if(fd_ != -1)
+		close(fd_);
+
+	fd_ = -1;
+#endif
+
+	data_ = nullptr;
+}
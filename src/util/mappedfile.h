@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+/// Read-only memory mapped file
+class MappedFile {
+
+public:
+	/// Throws std::exception if the file cannot be mapped
+	MappedFile(const std::string &filename);
+	MappedFile(const MappedFile &) = delete;
+	~MappedFile();
+
+public:
+	inline const uint8_t *data() const {
+		return data_;
+	}
+
+	inline size_t size() const {
+		return size_;
+	}
+
+private:
+	void release();
+
+private:
+	const uint8_t *data_ = nullptr;
+	size_t size_ = 0;
+
+private:
+#ifdef _WINDOWS
+	void *file_ = nullptr, *mapping_ = nullptr;
+#else
+	int fd_ = -1;
+#endif
+
+};
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdint>
+#include <utility>
+
 /// Very fast cache that keeps a fixed number of results
 template<typename Key>
 class QuickCache {
@@ -20,3 +23,62 @@ private:
 	Key lastKey_;
 
 };
+
+/// Small fixed-size associative cache (LRU replacement). Values are moved in and returned by reference, so they are never copied.
+template<typename Key, typename Value, int ways>
+class AssociativeQuickCache {
+
+public:
+	AssociativeQuickCache() {
+		for(int i = 0; i < ways; i++)
+			order_[i] = static_cast<uint8_t>(i);
+	}
+
+public:
+	/// Returns the cached value for the key (and marks it as the most recently used) or nullptr
+	inline Value *find(const Key &key) {
+		for(int i = 0; i < count_; i++) {
+			const uint8_t slot = order_[i];
+			if(!(keys_[slot] == key))
+				continue;
+
+			touch(i);
+			return &values_[slot];
+		}
+
+		return nullptr;
+	}
+
+	/// Stores the value under the key, replacing the least recently used one if the cache is full. The key must not be in the cache.
+	inline Value &insert(const Key &key, Value &&value) {
+		if(count_ < ways)
+			count_++;
+
+		const int i = count_ - 1;
+		const uint8_t slot = order_[i];
+		keys_[slot] = key;
+		values_[slot] = std::move(value);
+
+		touch(i);
+		return values_[slot];
+	}
+
+private:
+	/// Moves the slot on the order position i to the front
+	inline void touch(int i) {
+		const uint8_t slot = order_[i];
+		for(; i > 0; i--)
+			order_[i] = order_[i - 1];
+
+		order_[0] = slot;
+	}
+
+private:
+	Key keys_[ways];
+	Value values_[ways];
+
+	/// Slot indexes, most recently used first
+	uint8_t order_[ways];
+	int count_ = 0;
+
+};
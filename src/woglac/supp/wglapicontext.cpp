@@ -1,8 +1,201 @@
 #include "wglapicontext.h"
 
+#include "util/iterators.h"
+
+namespace {
+	constexpr uint32_t noSymbolID = static_cast<uint32_t>(-1);
+}
+
+template<typename T>
+T *WGLAPIContext::registerSymbol(T *sym) {
+	// Each operation result gets its own slot, even if the symbol is already known (deduplicated/folded values),
+	// so that the IDs stay aligned with the operations on replay
+	symbols_.push_back(sym);
+
+	if(sym)
+		symbolIDs_.emplace(sym, static_cast<uint32_t>(symbols_.size() - 1));
+
+	return sym;
+}
+
+template<typename... Args>
+void WGLAPIContext::record(Op op, const Args &...args) {
+	if(!recordProgram)
+		return;
+
+	WGLProgramWriter w(recordProgram->data);
+	w.write(op);
+	(writeArg(w, args), ...);
+}
+
+template<typename T>
+void WGLAPIContext::writeArg(WGLProgramWriter &w, const T &arg) {
+	if constexpr(std::is_pointer_v<T>)
+		w.write(arg ? symbolIDs_.at(arg) : noSymbolID);
+
+	else if constexpr(std::is_same_v<T, V3F>) {
+		for(int i = 0; i < 3; i++)
+			w.write(arg[i]);
+	}
+
+	else if constexpr(std::is_same_v<T, WorldGenAPI::FunctionArgs>) {
+		w.write(static_cast<uint32_t>(arg.size()));
+		for(WGA_Value *v: arg)
+			writeArg(w, v);
+	}
+
+	else if constexpr(std::is_same_v<T, WGA_Symbol::PragmaValue>) {
+		w.write(static_cast<uint8_t>(arg.index()));
+		std::visit([&](const auto &v) { w.write(v); }, arg);
+	}
+
+	else if constexpr(std::is_same_v<T, WGA_Biome::Condition>) {
+		writeArg(w, arg.param);
+		w.write(arg.mean);
+		w.write(arg.deviation);
+	}
+
+	else if constexpr(std::is_same_v<T, WGA_GrammarSymbol::Condition>)
+		writeArg(w, arg.value);
+
+	else if constexpr(std::is_same_v<T, WGA_ComponentNode::Config>) {
+		w.write(arg.group);
+		writeArg(w, arg.position);
+		writeArg(w, arg.rule);
+		w.write(arg.orientation);
+	}
+
+	else if constexpr(std::is_same_v<T, WGA_Component::Area>) {
+		w.write(arg.name);
+		writeArg(w, arg.startPos);
+		writeArg(w, arg.endPos);
+		w.write(arg.canOverlap);
+		w.write(arg.mustOverlap);
+		w.write(arg.isVirtual);
+	}
+
+	else if constexpr(std::is_same_v<T, WGA_Component::Blocks>) {
+		writeArg(w, arg.startPos);
+		writeArg(w, arg.endPos);
+		writeArg(w, arg.positionsOffset);
+		writeArg(w, arg.block);
+
+		w.write(static_cast<uint32_t>(arg.positions.size()));
+		for(const BlockWorldPos &p: arg.positions) {
+			for(int i = 0; i < 3; i++)
+				w.write(p[i]);
+		}
+	}
+
+	else
+		w.write(arg);
+}
+
+template<typename T>
+T WGLAPIContext::readArg(WGLProgramReader &r) {
+	if constexpr(std::is_pointer_v<T>) {
+		const uint32_t id = r.read<uint32_t>();
+		if(id == noSymbolID)
+			return nullptr;
+
+		T result = id < symbols_.size() ? dynamic_cast<T>(symbols_[id]) : nullptr;
+		if(!result)
+			throw std::exception("Corrupted WOGLAC program data.");
+
+		return result;
+	}
+
+	else if constexpr(std::is_same_v<T, V3F>) {
+		V3F result;
+		for(int i = 0; i < 3; i++)
+			result[i] = r.read<float>();
+
+		return result;
+	}
+
+	else if constexpr(std::is_same_v<T, WorldGenAPI::FunctionArgs>) {
+		WorldGenAPI::FunctionArgs result(r.read<uint32_t>());
+		for(WGA_Value *&v: result)
+			v = readArg<WGA_Value *>(r);
+
+		return result;
+	}
+
+	else if constexpr(std::is_same_v<T, WGA_Symbol::PragmaValue>) {
+		switch(r.read<uint8_t>()) {
+
+			case 0:
+				return r.read<std::string>();
+
+			case 1:
+				return r.read<float>();
+
+			case 2:
+				return r.read<bool>();
+
+			default:
+				throw std::exception("Corrupted WOGLAC program data.");
+
+		}
+	}
+
+	else if constexpr(std::is_same_v<T, WGA_Biome::Condition>) {
+		WGA_Biome::Condition result;
+		result.param = readArg<WGA_Value *>(r);
+		result.mean = r.read<float>();
+		result.deviation = r.read<float>();
+		return result;
+	}
+
+	else if constexpr(std::is_same_v<T, WGA_GrammarSymbol::Condition>) {
+		WGA_GrammarSymbol::Condition result;
+		result.value = readArg<WGA_Value *>(r);
+		return result;
+	}
+
+	else if constexpr(std::is_same_v<T, WGA_ComponentNode::Config>) {
+		WGA_ComponentNode::Config result;
+		result.group = r.read<std::string>();
+		result.position = readArg<WGA_Value *>(r);
+		result.rule = readArg<WGA_Rule *>(r);
+		result.orientation = r.read<BlockOrientation>();
+		return result;
+	}
+
+	else if constexpr(std::is_same_v<T, WGA_Component::Area>) {
+		WGA_Component::Area result;
+		result.name = r.read<std::string>();
+		result.startPos = readArg<WGA_Value *>(r);
+		result.endPos = readArg<WGA_Value *>(r);
+		result.canOverlap = r.read<bool>();
+		result.mustOverlap = r.read<bool>();
+		result.isVirtual = r.read<bool>();
+		return result;
+	}
+
+	else if constexpr(std::is_same_v<T, WGA_Component::Blocks>) {
+		WGA_Component::Blocks result;
+		result.startPos = readArg<WGA_Value *>(r);
+		result.endPos = readArg<WGA_Value *>(r);
+		result.positionsOffset = readArg<WGA_Value *>(r);
+		result.block = readArg<WGA_Value *>(r);
+
+		result.positions.resize(r.read<uint32_t>());
+		for(BlockWorldPos &p: result.positions) {
+			for(int i = 0; i < 3; i++)
+				p[i] = r.read<BlockWorldPos_T>();
+		}
+
+		return result;
+	}
+
+	else
+		return r.read<T>();
+}
+
 void WGLAPIContext::addSymbolMapping(WGLSymbol *wglSym, WGA_Symbol *wgaSym) {
 	ASSERT(!symbolMapping_.contains(wglSym));
-	wgaSym->setDescription(wglSym->name().empty() ? wglSym->desc() : wglSym->fullName());
+	setDescription(wgaSym, wglSym->name().empty() ? wglSym->desc() : wglSym->fullName(), DescriptionPriority::Symbol);
 	symbolMapping_[wglSym] = wgaSym;
 }
 
@@ -14,3 +207,350 @@ WGA_Value *WGLAPIContext::expr(const WGLExpressionResult &expr) {
 	ASSERT(r->valueType() == expr.type);
 	return r;
 }
+
+void WGLAPIContext::replay(const WGLProgram &program) {
+	ASSERT(!recordProgram);
+
+	WGLProgramReader r(program.operations());
+	while(!r.atEnd()) {
+		switch(r.read<Op>()) {
+
+			case Op::NewBiome:
+				newBiome();
+				break;
+
+			case Op::NewRule:
+				newRule();
+				break;
+
+			case Op::NewRuleExpansion:
+				newRuleExpansion(readArg<WGA_Rule *>(r));
+				break;
+
+			case Op::NewRuleExpansionToComponent: {
+				const auto rule = readArg<WGA_Rule *>(r);
+				const auto component = readArg<WGA_Component *>(r);
+				const auto node = readArg<std::string>(r);
+				newRuleExpansion(rule, component, node);
+				break;
+			}
+
+			case Op::NewRuleExpansionToRule: {
+				const auto rule = readArg<WGA_Rule *>(r);
+				const auto targetRule = readArg<WGA_Rule *>(r);
+				newRuleExpansion(rule, targetRule);
+				break;
+			}
+
+			case Op::NewComponent:
+				newComponent();
+				break;
+
+			case Op::NewComponentNode:
+				newComponentNode();
+				break;
+
+			case Op::ConstFloat:
+				constFloat(readArg<float>(r));
+				break;
+
+			case Op::ConstFloat3:
+				constFloat3(readArg<V3F>(r));
+				break;
+
+			case Op::ConstBlock:
+				constBlock(readArg<std::string>(r));
+				break;
+
+			case Op::ConstBool:
+				constBool(readArg<bool>(r));
+				break;
+
+			case Op::ConstRule:
+				constRule(readArg<WGA_Rule *>(r));
+				break;
+
+			case Op::ConstComponentNode:
+				constComponentNode(readArg<WGA_ComponentNode *>(r));
+				break;
+
+			case Op::Function: {
+				const auto fid = readArg<WorldGenAPI::FunctionID>(r);
+				const auto args = readArg<WorldGenAPI::FunctionArgs>(r);
+				function(fid, args);
+				break;
+			}
+
+			case Op::Proxy:
+				proxy(readArg<WGA_Value *>(r));
+				break;
+
+			case Op::GrammarSymbolParam: {
+				const auto sym = readArg<WGA_GrammarSymbol *>(r);
+				const auto name = readArg<std::string>(r);
+				const auto type = readArg<WGA_Value::ValueType>(r);
+				const auto defaultValue = readArg<WGA_Value *>(r);
+				grammarSymbolParam(sym, name, type, defaultValue);
+				break;
+			}
+
+			case Op::SetDescription: {
+				const auto sym = readArg<WGA_Symbol *>(r);
+				const auto desc = readArg<std::string>(r);
+				const auto priority = readArg<DescriptionPriority>(r);
+				setDescription(sym, desc, priority);
+				break;
+			}
+
+			case Op::SetPragma: {
+				const auto sym = readArg<WGA_Symbol *>(r);
+				const auto name = readArg<std::string>(r);
+				const auto value = readArg<WGA_Symbol::PragmaValue>(r);
+				setPragma(sym, name, value);
+				break;
+			}
+
+			case Op::CopyPragmas: {
+				const auto target = readArg<WGA_Symbol *>(r);
+				const auto source = readArg<WGA_Symbol *>(r);
+				copyPragmas(target, source);
+				break;
+			}
+
+			case Op::AddBiomeCondition: {
+				const auto biome = readArg<WGA_Biome *>(r);
+				const auto cond = readArg<WGA_Biome::Condition>(r);
+				addBiomeCondition(biome, cond);
+				break;
+			}
+
+			case Op::SetBiomeParam: {
+				const auto biome = readArg<WGA_Biome *>(r);
+				const auto param = readArg<WGA_Value *>(r);
+				const auto value = readArg<WGA_Value *>(r);
+				setBiomeParam(biome, param, value);
+				break;
+			}
+
+			case Op::SetBiomeGridSize:
+				setBiomeGridSize(readArg<BlockWorldPos_T>(r));
+				break;
+
+			case Op::SetParam: {
+				const auto sym = readArg<WGA_GrammarSymbol *>(r);
+				const auto param = readArg<std::string>(r);
+				const auto value = readArg<WGA_Value *>(r);
+				setParam(sym, param, value);
+				break;
+			}
+
+			case Op::AddCondition: {
+				const auto sym = readArg<WGA_GrammarSymbol *>(r);
+				const auto cond = readArg<WGA_GrammarSymbol::Condition>(r);
+				addCondition(sym, cond);
+				break;
+			}
+
+			case Op::SetComponentNodeConfig: {
+				const auto node = readArg<WGA_ComponentNode *>(r);
+				const auto config = readArg<WGA_ComponentNode::Config>(r);
+				setComponentNodeConfig(node, config);
+				break;
+			}
+
+			case Op::AddNode: {
+				const auto component = readArg<WGA_Component *>(r);
+				const auto node = readArg<WGA_ComponentNode *>(r);
+				addNode(component, node);
+				break;
+			}
+
+			case Op::AddArea: {
+				const auto component = readArg<WGA_Component *>(r);
+				const auto area = readArg<WGA_Component::Area>(r);
+				addArea(component, area);
+				break;
+			}
+
+			case Op::AddBlocks: {
+				const auto component = readArg<WGA_Component *>(r);
+				const auto blocks = readArg<WGA_Component::Blocks>(r);
+				addBlocks(component, blocks);
+				break;
+			}
+
+			case Op::AddExport: {
+				const auto name = readArg<std::string>(r);
+				const auto value = readArg<WGA_Value *>(r);
+				addExport(name, value);
+				break;
+			}
+
+			default:
+				throw std::exception("Corrupted WOGLAC program data.");
+
+		}
+	}
+}
+
+void WGLAPIContext::addExport(const std::string &name, WGA_Value *value) {
+	record(Op::AddExport, name, value);
+	exports_[name] = value;
+}
+
+WGA_Biome *WGLAPIContext::newBiome() {
+	record(Op::NewBiome);
+	return registerSymbol(api->newBiome());
+}
+
+WGA_Rule *WGLAPIContext::newRule() {
+	record(Op::NewRule);
+	return registerSymbol(api->newRule());
+}
+
+WGA_RuleExpansion *WGLAPIContext::newRuleExpansion(WGA_Rule *rule) {
+	record(Op::NewRuleExpansion, rule);
+	return registerSymbol(api->newRuleExpansion(rule));
+}
+
+WGA_RuleExpansion *WGLAPIContext::newRuleExpansion(WGA_Rule *rule, WGA_Component *component, const std::string &node) {
+	record(Op::NewRuleExpansionToComponent, rule, component, node);
+	return registerSymbol(api->newRuleExpansion(rule, component, node));
+}
+
+WGA_RuleExpansion *WGLAPIContext::newRuleExpansion(WGA_Rule *rule, WGA_Rule *targetRule) {
+	record(Op::NewRuleExpansionToRule, rule, targetRule);
+	return registerSymbol(api->newRuleExpansion(rule, targetRule));
+}
+
+WGA_Component *WGLAPIContext::newComponent() {
+	record(Op::NewComponent);
+	return registerSymbol(api->newComponent());
+}
+
+WGA_ComponentNode *WGLAPIContext::newComponentNode() {
+	record(Op::NewComponentNode);
+	return registerSymbol(api->newComponentNode());
+}
+
+WGA_Value *WGLAPIContext::constFloat(float val) {
+	record(Op::ConstFloat, val);
+	return registerSymbol(api->constFloat(val));
+}
+
+WGA_Value *WGLAPIContext::constFloat3(const V3F &val) {
+	record(Op::ConstFloat3, val);
+	return registerSymbol(api->constFloat3(val));
+}
+
+WGA_Value *WGLAPIContext::constBlock(const std::string &uid) {
+	// Block UIDs are resolved on each construction (the block mapping can differ between runs)
+	record(Op::ConstBlock, uid);
+	return registerSymbol(api->constBlock(uid));
+}
+
+WGA_Value *WGLAPIContext::constBool(bool val) {
+	record(Op::ConstBool, val);
+	return registerSymbol(api->constBool(val));
+}
+
+WGA_Value *WGLAPIContext::constRule(WGA_Rule *val) {
+	record(Op::ConstRule, val);
+	return registerSymbol(api->constRule(val));
+}
+
+WGA_Value *WGLAPIContext::constComponentNode(WGA_ComponentNode *val) {
+	record(Op::ConstComponentNode, val);
+	return registerSymbol(api->constComponentNode(val));
+}
+
+WGA_Value *WGLAPIContext::function(WorldGenAPI::FunctionID function, const WorldGenAPI::FunctionArgs &args) {
+	record(Op::Function, function, args);
+
+	WGA_Value *&r = functionCache_[{function, args}];
+	if(r)
+		return registerSymbol(r);
+
+	r = api->function(function, args);
+
+	if(iterator(args).mapx(!x->isContextual() && x->dimensionality() == WGA_Value::Dimensionality::DConst).all()) {
+		if(WGA_Value *folded = api->constFold(r))
+			r = folded;
+	}
+
+	return registerSymbol(r);
+}
+
+WGA_Value *WGLAPIContext::proxy(WGA_Value *v) {
+	record(Op::Proxy, v);
+	return registerSymbol(api->proxy(v));
+}
+
+WGA_Value *WGLAPIContext::grammarSymbolParam(WGA_GrammarSymbol *sym, const std::string &name, WGA_Value::ValueType type, WGA_Value *defaultValue) {
+	record(Op::GrammarSymbolParam, sym, name, type, defaultValue);
+	return registerSymbol(api->grammarSymbolParam(sym, name, type, defaultValue));
+}
+
+void WGLAPIContext::setDescription(WGA_Symbol *sym, const std::string &desc, DescriptionPriority priority) {
+	// Values can be shared (deduplicated function calls, constants) - keep the expression description they were first given, symbol names always override it
+	if(!describedSymbols_.insert(sym).second && priority == DescriptionPriority::Expression)
+		return;
+
+	record(Op::SetDescription, sym, desc, priority);
+	sym->setDescription(desc);
+}
+
+void WGLAPIContext::setPragma(WGA_Symbol *sym, const std::string &name, const WGA_Symbol::PragmaValue &value) {
+	record(Op::SetPragma, sym, name, value);
+	sym->setPragma(name, value);
+}
+
+void WGLAPIContext::copyPragmas(WGA_Symbol *target, WGA_Symbol *source) {
+	record(Op::CopyPragmas, target, source);
+	target->setPragmas(source->pragmas());
+}
+
+void WGLAPIContext::addBiomeCondition(WGA_Biome *biome, const WGA_Biome::Condition &cond) {
+	record(Op::AddBiomeCondition, biome, cond);
+	biome->addCondition(cond);
+}
+
+void WGLAPIContext::setBiomeParam(WGA_Biome *biome, WGA_Value *param, WGA_Value *value) {
+	record(Op::SetBiomeParam, biome, param, value);
+	biome->setParam(param, value);
+}
+
+void WGLAPIContext::setBiomeGridSize(BlockWorldPos_T size) {
+	record(Op::SetBiomeGridSize, size);
+	api->setBiomeGridSize(size);
+}
+
+void WGLAPIContext::setParam(WGA_GrammarSymbol *sym, const std::string &param, WGA_Value *value) {
+	record(Op::SetParam, sym, param, value);
+	sym->setParam(param, value);
+}
+
+void WGLAPIContext::addCondition(WGA_GrammarSymbol *sym, const WGA_GrammarSymbol::Condition &cond) {
+	record(Op::AddCondition, sym, cond);
+	sym->addCondition(cond);
+}
+
+void WGLAPIContext::setComponentNodeConfig(WGA_ComponentNode *node, const WGA_ComponentNode::Config &config) {
+	record(Op::SetComponentNodeConfig, node, config);
+	node->setConfig(config);
+}
+
+void WGLAPIContext::addNode(WGA_Component *component, WGA_ComponentNode *node) {
+	record(Op::AddNode, component, node);
+	component->addNode(node);
+}
+
+void WGLAPIContext::addArea(WGA_Component *component, const WGA_Component::Area &area) {
+	record(Op::AddArea, component, area);
+	component->addArea(area);
+}
+
+void WGLAPIContext::addBlocks(WGA_Component *component, const WGA_Component::Blocks &blocks) {
+	record(Op::AddBlocks, component, blocks);
+	component->addBlocks(blocks);
+}
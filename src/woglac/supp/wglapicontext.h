@@ -4,15 +4,21 @@
 #include "wglinclude.h"
 
 #include "worldgen/base/worldgenapi.h"
+#include "worldgen/base/supp/wga_componentnode.h"
 
 #include "wglsymbol.h"
 #include "wgldefines.h"
+#include "wglprogram.h"
 
+/// All WorldGenAPI operations of the compiled program go through the context, so that they can be recorded to a WGLProgram and replayed later
 class WGLAPIContext {
 
 public:
 	WorldGenAPI *api;
 
+	/// If set, all operations are recorded to the program
+	WGLProgram *recordProgram = nullptr;
+
 public:
 	void addSymbolMapping(WGLSymbol *wglSym, WGA_Symbol *wgaSym);
 
@@ -25,9 +31,122 @@ public:
 
 	WGA_Value *expr(const WGLExpressionResult &expr);
 
+public:
+	/// Executes all operations recorded in the program
+	void replay(const WGLProgram &program);
+
+	inline const auto &exports() const {
+		return exports_;
+	}
+
+	void addExport(const std::string &name, WGA_Value *value);
+
+public:
+	WGA_Biome *newBiome();
+	WGA_Rule *newRule();
+	WGA_RuleExpansion *newRuleExpansion(WGA_Rule *rule);
+	WGA_RuleExpansion *newRuleExpansion(WGA_Rule *rule, WGA_Component *component, const std::string &node);
+	WGA_RuleExpansion *newRuleExpansion(WGA_Rule *rule, WGA_Rule *targetRule);
+	WGA_Component *newComponent();
+	WGA_ComponentNode *newComponentNode();
+
+public:
+	WGA_Value *constFloat(float val);
+	WGA_Value *constFloat3(const V3F &val);
+	WGA_Value *constBlock(const std::string &uid);
+	WGA_Value *constBool(bool val);
+	WGA_Value *constRule(WGA_Rule *val);
+	WGA_Value *constComponentNode(WGA_ComponentNode *val);
+
+	/// Calls with the same function and arguments share a single value.
+	/// Calls with constant-only arguments are evaluated during the compilation if possible.
+	WGA_Value *function(WorldGenAPI::FunctionID function, const WorldGenAPI::FunctionArgs &args);
+
+	WGA_Value *proxy(WGA_Value *v);
+	WGA_Value *grammarSymbolParam(WGA_GrammarSymbol *sym, const std::string &name, WGA_Value::ValueType type, WGA_Value *defaultValue);
+
+public:
+	enum class DescriptionPriority : uint8_t {
+		Expression, ///< Call site text, only the first one is applied (the value can be shared by multiple expressions)
+		Symbol, ///< WOGLAC symbol names and labels, override expression descriptions
+	};
+
+	void setDescription(WGA_Symbol *sym, const std::string &desc, DescriptionPriority priority = DescriptionPriority::Expression);
+	void setPragma(WGA_Symbol *sym, const std::string &name, const WGA_Symbol::PragmaValue &value);
+	void copyPragmas(WGA_Symbol *target, WGA_Symbol *source);
+
+	void addBiomeCondition(WGA_Biome *biome, const WGA_Biome::Condition &cond);
+	void setBiomeParam(WGA_Biome *biome, WGA_Value *param, WGA_Value *value);
+	void setBiomeGridSize(BlockWorldPos_T size);
+
+	void setParam(WGA_GrammarSymbol *sym, const std::string &param, WGA_Value *value);
+	void addCondition(WGA_GrammarSymbol *sym, const WGA_GrammarSymbol::Condition &cond);
+
+	void setComponentNodeConfig(WGA_ComponentNode *node, const WGA_ComponentNode::Config &config);
+	void addNode(WGA_Component *component, WGA_ComponentNode *node);
+	void addArea(WGA_Component *component, const WGA_Component::Area &area);
+	void addBlocks(WGA_Component *component, const WGA_Component::Blocks &blocks);
+
+private:
+	enum class Op : uint8_t {
+		NewBiome,
+		NewRule,
+		NewRuleExpansion,
+		NewRuleExpansionToComponent,
+		NewRuleExpansionToRule,
+		NewComponent,
+		NewComponentNode,
+
+		ConstFloat,
+		ConstFloat3,
+		ConstBlock,
+		ConstBool,
+		ConstRule,
+		ConstComponentNode,
+		Function,
+		Proxy,
+		GrammarSymbolParam,
+
+		SetDescription,
+		SetPragma,
+		CopyPragmas,
+		AddBiomeCondition,
+		SetBiomeParam,
+		SetBiomeGridSize,
+		SetParam,
+		AddCondition,
+		SetComponentNodeConfig,
+		AddNode,
+		AddArea,
+		AddBlocks,
+
+		AddExport,
+	};
+
+private:
+	template<typename T>
+	T *registerSymbol(T *sym);
+
+	/// Records the operation with its arguments (if recording)
+	template<typename... Args>
+	void record(Op op, const Args &...args);
+
+	template<typename T>
+	void writeArg(WGLProgramWriter &w, const T &arg);
+
+	template<typename T>
+	T readArg(WGLProgramReader &r);
+
 private:
 	std::unordered_map<const WGLSymbol *, WGA_Symbol *> symbolMapping_;
 	std::unordered_map<std::string, WGA_Value*> exprCache_;
+	std::map<std::pair<WorldGenAPI::FunctionID, WorldGenAPI::FunctionArgs>, WGA_Value *> functionCache_;
+	std::unordered_map<std::string, WGA_Value *> exports_;
+	std::unordered_set<const WGA_Symbol *> describedSymbols_;
 
-};
+private:
+	/// Symbols are referenced by the index of the operation result in the program
+	std::unordered_map<const WGA_Symbol *, uint32_t> symbolIDs_;
+	std::vector<WGA_Symbol *> symbols_;
 
+};
@@ -19,7 +19,7 @@ void WGLContext::clear() {
 	astSymbolMapping.clear();
 	allSymbols.clear();
 
-	unresolvedApiCmds_.clear();
+	apiCmds_.clear();
 	resolvedApiCmds_.clear();
 	definedSymbols_.clear();
 	symbolApiCmdDependents_.clear();
@@ -28,7 +28,7 @@ void WGLContext::clear() {
 	//markSymbolDefined(rootSymbol);
 }
 
-void WGLContext::addApiCmd(WGLSymbol *definingSymbol, const WGLDependencyList &dependencies, const WGLContext::APICommand &cmd) {
+void WGLContext::addApiCmd(WGLSymbol *definingSymbol, const WGLDependencyList &dependencies, const WGLContext::APICommand &cmd, WGLSymbol *owner) {
 	ASSERT(!definedSymbols_.contains(definingSymbol));
 
 	int unresolvedCount = 0;
@@ -38,23 +38,80 @@ void WGLContext::addApiCmd(WGLSymbol *definingSymbol, const WGLDependencyList &d
 			unresolvedCount++;
 	}
 
+	const int id = apiCmds_.size();
+	apiCmds_.push_back(APICmd{cmd, definingSymbol, owner ? owner : definingSymbol, dependencies, unresolvedCount});
+
 	if(!unresolvedCount) {
-		resolvedApiCmds_.push_back(cmd);
+		resolvedApiCmds_.push_back(id);
 		if(definingSymbol)
 			markSymbolDefined(definingSymbol);
 
 		return;
 	}
 
-	const int id = unresolvedApiCmds_.size();
-	unresolvedApiCmds_.push_back(UnresolvedAPICmd{cmd, definingSymbol, unresolvedCount});
-
 	for(WGLSymbol *s: dependencies) {
 		if(s && !definedSymbols_.contains(s))
 			symbolApiCmdDependents_.insert({s, id});
 	}
 }
 
+std::vector<WGLContext::APICommand> WGLContext::reachableApiCommands(const std::vector<WGLSymbol *> &roots) const {
+	// Commands that are needed when a given symbol is used
+	std::unordered_multimap<WGLSymbol *, int> symbolCommands;
+
+	std::unordered_set<WGLSymbol *> reachableSymbols;
+	std::vector<WGLSymbol *> symbolStack;
+	std::vector<bool> isCommandReachable(apiCmds_.size(), false);
+
+	const auto markSymbol = [&](WGLSymbol *s) {
+		if(s && reachableSymbols.insert(s).second)
+			symbolStack.push_back(s);
+	};
+	const auto markCommand = [&](int id) {
+		if(isCommandReachable[id])
+			return;
+
+		const APICmd &cmd = apiCmds_[id];
+		isCommandReachable[id] = true;
+
+		markSymbol(cmd.definingSymbol);
+		for(WGLSymbol *s: cmd.dependencies)
+			markSymbol(s);
+	};
+
+	for(int id = 0; id < apiCmds_.size(); id++) {
+		const APICmd &cmd = apiCmds_[id];
+
+		if(!cmd.owner && !cmd.definingSymbol)
+			markCommand(id);
+
+		if(cmd.owner)
+			symbolCommands.insert({cmd.owner, id});
+
+		if(cmd.definingSymbol && cmd.definingSymbol != cmd.owner)
+			symbolCommands.insert({cmd.definingSymbol, id});
+	}
+
+	for(WGLSymbol *s: roots)
+		markSymbol(s);
+
+	while(!symbolStack.empty()) {
+		WGLSymbol *s = symbolStack.back();
+		symbolStack.pop_back();
+
+		for(auto it = symbolCommands.find(s); it != symbolCommands.end() && it->first == s; it++)
+			markCommand(it->second);
+	}
+
+	std::vector<APICommand> result;
+	for(int id: resolvedApiCmds_) {
+		if(isCommandReachable[id])
+			result.push_back(apiCmds_[id].command);
+	}
+
+	return result;
+}
+
 void WGLContext::checkCircularDependencies() {
 	if(symbolApiCmdDependents_.empty())
 		return;
@@ -62,7 +119,7 @@ void WGLContext::checkCircularDependencies() {
 	std::vector<std::string> err{"Circular dependencies detected. Relevant symbols:"};
 
 	for(auto it = symbolApiCmdDependents_.begin(); it != symbolApiCmdDependents_.end(); it++) {
-		WGLSymbol *l = it->first, *r = unresolvedApiCmds_[it->second].definingSymbol;
+		WGLSymbol *l = it->first, *r = apiCmds_[it->second].definingSymbol;
 		const std::string line = r ? std::to_string(r->declarationAst_->getStart()->getLine()) : std::string{};
 
 		err.push_back(std::format("[{}] {} -> {}", line, r ? r->fullName() : "??", l ? l->fullName() : "??"));
@@ -77,12 +134,12 @@ void WGLContext::markSymbolDefined(WGLSymbol *s) {
 	std::vector<WGLSymbol *> newlyDefinedSymbols;
 
 	for(auto it = symbolApiCmdDependents_.find(s); it != symbolApiCmdDependents_.end() && it->first == s; it++) {
-		UnresolvedAPICmd &rec = unresolvedApiCmds_[it->second];
+		APICmd &rec = apiCmds_[it->second];
 		ASSERT(rec.unresolvedDependencyCount > 0);
 
 		rec.unresolvedDependencyCount--;
 		if(!rec.unresolvedDependencyCount) {
-			resolvedApiCmds_.push_back(rec.command);
+			resolvedApiCmds_.push_back(it->second);
 			if(rec.definingSymbol)
 				newlyDefinedSymbols.push_back(rec.definingSymbol);
 		}
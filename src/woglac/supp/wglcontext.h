@@ -31,17 +31,20 @@ public:
 	std::unordered_map<antlr4::ParserRuleContext *, WGLSymbol *> astSymbolMapping;
 
 public:
-	void addApiCmd(WGLSymbol *definingSymbol, const WGLDependencyList &dependencies, const APICommand &cmd);
+	/// Owner is the symbol that requires the command to be executed when it is used (defaults to definingSymbol).
+	/// Commands with neither defining symbol nor owner are always executed.
+	void addApiCmd(WGLSymbol *definingSymbol, const WGLDependencyList &dependencies, const APICommand &cmd, WGLSymbol *owner = nullptr);
 	void checkCircularDependencies();
 
-	inline const auto &apiCommands() {
-		return resolvedApiCmds_;
-	}
+	/// Returns commands required for constructing the given root symbols (and everything they use), in the execution order
+	std::vector<APICommand> reachableApiCommands(const std::vector<WGLSymbol *> &roots) const;
 
 private:
-	struct UnresolvedAPICmd {
+	struct APICmd {
 		APICommand command;
 		WGLSymbol *definingSymbol;
+		WGLSymbol *owner;
+		WGLDependencyList dependencies;
 		int unresolvedDependencyCount;
 	};
 
@@ -49,8 +52,10 @@ private:
 	void markSymbolDefined(WGLSymbol *s);
 
 private:
-	std::vector<UnresolvedAPICmd> unresolvedApiCmds_;
-	std::vector<APICommand> resolvedApiCmds_;
+	std::vector<APICmd> apiCmds_;
+
+	/// Indexes to apiCmds_, in the order the commands can be executed
+	std::vector<int> resolvedApiCmds_;
 	std::unordered_set<WGLSymbol *> definedSymbols_;
 
 	/// List of what api cmds depend on a given symbol
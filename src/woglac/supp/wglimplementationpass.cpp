@@ -26,19 +26,19 @@ void WGLImplementationPass::enterScope(WoglacParser::ScopeContext *ctx) {
 
 			case SymbolType::Biome:
 				ctx_->addApiCmd(sym, {}, [sym](WGLAPIContext &ctx) {
-					ctx.addSymbolMapping(sym, ctx.api->newBiome());
+					ctx.addSymbolMapping(sym, ctx.newBiome());
 				});
 				break;
 
 			case SymbolType::Rule:
 				ctx_->addApiCmd(sym, {}, [sym](WGLAPIContext &ctx) {
-					ctx.addSymbolMapping(sym, ctx.api->newRule());
+					ctx.addSymbolMapping(sym, ctx.newRule());
 				});
 				break;
 
 			case SymbolType::Component:
 				ctx_->addApiCmd(sym, {}, [sym](WGLAPIContext &ctx) {
-					ctx.addSymbolMapping(sym, ctx.api->newComponent());
+					ctx.addSymbolMapping(sym, ctx.newComponent());
 				});
 				break;
 
@@ -84,17 +84,17 @@ void WGLImplementationPass::enterRuleExpansionStatement(WoglacParser::RuleExpans
 		WGA_RuleExpansion *rex;
 
 		if(!target)
-			rex = ctx.api->newRuleExpansion(ctx.map<WGA_Rule>(parentRule));
+			rex = ctx.newRuleExpansion(ctx.map<WGA_Rule>(parentRule));
 		else if(expandsToComponent)
-			rex = ctx.api->newRuleExpansion(ctx.map<WGA_Rule>(parentRule), ctx.map<WGA_Component>(target), node);
+			rex = ctx.newRuleExpansion(ctx.map<WGA_Rule>(parentRule), ctx.map<WGA_Component>(target), node);
 		else
-			rex = ctx.api->newRuleExpansion(ctx.map<WGA_Rule>(parentRule), ctx.map<WGA_Rule>(target));
+			rex = ctx.newRuleExpansion(ctx.map<WGA_Rule>(parentRule), ctx.map<WGA_Rule>(target));
 
 		for(const auto &ps: pragmaSets)
-			rex->setPragma(ps.first, ps.second);
+			ctx.setPragma(rex, ps.first, ps.second);
 
 		ctx.addSymbolMapping(sym, rex);
-	});
+	}, parentRule);
 }
 
 void WGLImplementationPass::exitRuleExpansionStatement(WoglacParser::RuleExpansionStatementContext *ctx) {
@@ -111,8 +111,8 @@ void WGLImplementationPass::enterBiomeParamDefinition(WoglacParser::BiomeParamDe
 	ctx_->addApiCmd(sym, deps, [sym, val](WGLAPIContext &ctx) {
 		// We use proxy to prevent problems when having multiple biome params with the same default value (or when overriding the default value with the actual default value expression)
 		auto vf = ctx.expr(val);
-		vf->setDescription("PROXY:" + sym->desc());
-		ctx.addSymbolMapping(sym, ctx.api->proxy(vf));
+		ctx.setDescription(vf, "PROXY:" + sym->desc(), WGLAPIContext::DescriptionPriority::Symbol);
+		ctx.addSymbolMapping(sym, ctx.proxy(vf));
 	});
 }
 
@@ -129,8 +129,8 @@ void WGLImplementationPass::enterBiomeConditionStatement(WoglacParser::BiomeCond
 	const float dev = WGLUtils::numericLiteral(ctx->dev);
 
 	ctx_->addApiCmd(nullptr, {target, param}, [target, param, mean, dev](WGLAPIContext &ctx) {
-		ctx.map<WGA_Biome>(target)->addCondition(WGA_Biome::Condition{ctx.map<WGA_Value>(param), mean, dev});
-	});
+		ctx.addBiomeCondition(ctx.map<WGA_Biome>(target), WGA_Biome::Condition{ctx.map<WGA_Value>(param), mean, dev});
+	}, target);
 }
 
 void WGLImplementationPass::enterVariableDefinition(WoglacParser::VariableDefinitionContext *ctx) {
@@ -163,8 +163,8 @@ void WGLImplementationPass::enterParamDefinition(WoglacParser::ParamDefinitionCo
 		throw WGLError(std::format("Structure parameter '{}' is defined as type '{}' but the default value expression is of type '{}'.", sym->fullName(), WGA_Value::typeNames.at(sym->valueType), WGA_Value::typeNames.at(defaultValue.type)), ctx);
 
 	ctx_->addApiCmd(sym, deps, [sym, parent, defaultValue](WGLAPIContext &ctx) {
-		ctx.addSymbolMapping(sym, ctx.api->grammarSymbolParam(ctx.map<WGA_GrammarSymbol>(parent), sym->name(), sym->valueType, defaultValue.func ? ctx.expr(defaultValue) : nullptr));
-	});
+		ctx.addSymbolMapping(sym, ctx.grammarSymbolParam(ctx.map<WGA_GrammarSymbol>(parent), sym->name(), sym->valueType, defaultValue.func ? ctx.expr(defaultValue) : nullptr));
+	}, parent);
 }
 
 void WGLImplementationPass::enterParamSetStatement(WoglacParser::ParamSetStatementContext *ctx) {
@@ -190,8 +190,8 @@ void WGLImplementationPass::enterParamSetStatement(WoglacParser::ParamSetStateme
 			throw WGLError(std::format("Biome param '{}' is of type '{}', but type '{}' provided in the specification for biome '{}'.", param->fullName(), WGA_Value::typeNames.at(param->valueType), WGA_Value::typeNames.at(val.type), target->fullName()), ctx);
 
 		ctx_->addApiCmd(nullptr, deps, [target, param, val](WGLAPIContext &ctx) {
-			ctx.map<WGA_Biome>(target)->setParam(ctx.map<WGA_Value>(param), ctx.expr(val));
-		});
+			ctx.setBiomeParam(ctx.map<WGA_Biome>(target), ctx.map<WGA_Value>(param), ctx.expr(val));
+		}, target);
 	}
 	else if(targetType == SymbolType::Rule || targetType == SymbolType::RuleExpansion ||
 	        targetType == SymbolType::Component) {
@@ -201,8 +201,8 @@ void WGLImplementationPass::enterParamSetStatement(WoglacParser::ParamSetStateme
 		const std::string paramName = WGLUtils::identifier(ctx->param->id[0]);
 
 		ctx_->addApiCmd(nullptr, deps, [target, paramName, val](WGLAPIContext &ctx) {
-			ctx.map<WGA_GrammarSymbol>(target)->setParam(paramName, ctx.expr(val));
-		});
+			ctx.setParam(ctx.map<WGA_GrammarSymbol>(target), paramName, ctx.expr(val));
+		}, target);
 	}
 	else
 		throw WGLError("Param set statements are allowed only for biome, rule, component and rule expansion targets.", ctx);
@@ -255,7 +255,9 @@ void WGLImplementationPass::enterComponentIncludeStatementBlockParam(WoglacParse
 		return;
 	}
 
-	WGLDependencyList deps;
+	WGLDependencyList deps{
+		component
+	};
 	const auto val = expression(ctx->val, deps);
 
 	std::vector<BlockWorldPos> poss;
@@ -270,8 +272,8 @@ void WGLImplementationPass::enterComponentIncludeStatementBlockParam(WoglacParse
 		blocks.block = ctx.expr(val);
 		blocks.positions = poss;
 
-		ctx.map<WGA_Component>(component)->addBlocks(blocks);
-	});
+		ctx.addBlocks(ctx.map<WGA_Component>(component), blocks);
+	}, component);
 }
 
 void WGLImplementationPass::enterComponentIncludeStatementNodeParam(WoglacParser::ComponentIncludeStatementNodeParamContext *ctx) {
@@ -291,7 +293,7 @@ void WGLImplementationPass::enterComponentIncludeStatementNodeParam(WoglacParser
 
 	WGLSymbol *node = componentNodeDeclaration(ctx->com, currentScope());
 	componentNodeCommonPart(node, ctx->com, component, deps, [pos = *componentIncludePositions_.begin()](WGLAPIContext &ctx, WGA_ComponentNode::Config &cfg) {
-		cfg.position = ctx.api->constFloat3(pos.to<float>());
+		cfg.position = ctx.constFloat3(pos.to<float>());
 	});
 
 	currentScope_.push(node);
@@ -312,12 +314,12 @@ void WGLImplementationPass::exitComponentIncludeStatementNodeParam(WoglacParser:
 		WGLDependencyList deps;
 
 		componentNodeCommonPart(node, ctx->com, sourceNode->parent()->effectiveTarget(), deps, [pos](WGLAPIContext &ctx, WGA_ComponentNode::Config &cfg) {
-			cfg.position = ctx.api->constFloat3(pos.to<float>());
+			cfg.position = ctx.constFloat3(pos.to<float>());
 		});
 
-		ctx_->addApiCmd(nullptr, {}, [sourceNode, node](WGLAPIContext &ctx) {
-			ctx.map<WGA_ComponentNode>(node)->setPragmas(ctx.map<WGA_ComponentNode>(sourceNode)->pragmas());
-		});
+		ctx_->addApiCmd(nullptr, {sourceNode, node}, [sourceNode, node](WGLAPIContext &ctx) {
+			ctx.copyPragmas(ctx.map<WGA_ComponentNode>(node), ctx.map<WGA_ComponentNode>(sourceNode));
+		}, node);
 	}
 }
 
@@ -345,8 +347,8 @@ void WGLImplementationPass::enterComponentAreaStatement(WoglacParser::ComponentA
 		area.startPos = ctx.expr(startPos);
 		area.endPos = ctx.expr(endPos);
 
-		ctx.map<WGA_Component>(component)->addArea(area);
-	});
+		ctx.addArea(ctx.map<WGA_Component>(component), area);
+	}, component);
 }
 
 void WGLImplementationPass::enterComponentBlockStatement(WoglacParser::ComponentBlockStatementContext *ctx) {
@@ -371,8 +373,8 @@ void WGLImplementationPass::enterComponentBlockStatement(WoglacParser::Component
 		area.endPos = endPos.func ? ctx.expr(endPos) : nullptr;
 		area.block = ctx.expr(value);
 
-		ctx.map<WGA_Component>(component)->addBlocks(area);
-	});
+		ctx.addBlocks(ctx.map<WGA_Component>(component), area);
+	}, component);
 }
 
 void WGLImplementationPass::enterStructureConditionStatement(WoglacParser::StructureConditionStatementContext *ctx) {
@@ -397,8 +399,8 @@ void WGLImplementationPass::enterStructureConditionStatement(WoglacParser::Struc
 		WGA_GrammarSymbol::Condition cond;
 		cond.value = ctx.expr(val);
 
-		ctx.map<WGA_GrammarSymbol>(target)->addCondition(cond);
-	});
+		ctx.addCondition(ctx.map<WGA_GrammarSymbol>(target), cond);
+	}, target);
 }
 
 void WGLImplementationPass::enterPragmaStatement(WoglacParser::PragmaStatementContext *ctx) {
@@ -423,7 +425,7 @@ void WGLImplementationPass::enterPragmaStatement(WoglacParser::PragmaStatementCo
 
 	if(!target->parent() && name == "biomeGridSize") {
 		ctx_->addApiCmd(nullptr, {}, [value](WGLAPIContext &ctx) {
-			ctx.api->setBiomeGridSize(std::get<float>(value));
+			ctx.setBiomeGridSize(static_cast<BlockWorldPos_T>(std::get<float>(value)));
 		});
 	}
 	else {
@@ -437,8 +439,8 @@ void WGLImplementationPass::enterPragmaStatement(WoglacParser::PragmaStatementCo
 			throw WGLError::WGLError("Pragmas are not supported for the given context.", ctx);
 
 		ctx_->addApiCmd(nullptr, {target}, [target, name, value](WGLAPIContext &ctx) {
-			ctx.map<WGA_Symbol>(target)->setPragma(name, value);
-		});
+			ctx.setPragma(ctx.map<WGA_Symbol>(target), name, value);
+		}, target);
 	}
 }
 
@@ -564,17 +566,17 @@ WGLExpressionResult WGLImplementationPass::expression(WoglacParser::LiteralExpre
 		if(!block)
 			throw WoglacSemanticError(QStringLiteral("Unknown block uid '%1'").arg(uid), this, ctx);*/
 
-		return EXPRESSION_RESULT(ValueType::Block, ctx.api->constBlock(uid), std::format("(CONSTBLOCK;{})", uid));
+		return EXPRESSION_RESULT(ValueType::Block, ctx.constBlock(uid), std::format("(CONSTBLOCK;{})", uid));
 	}
 
 	if(auto e = ctx->num) {
 		const float val = WGLUtils::numericLiteral(e);
-		return EXPRESSION_RESULT(ValueType::Float, ctx.api->constFloat(val), std::format("(CONSTFLOAT;{})", val));
+		return EXPRESSION_RESULT(ValueType::Float, ctx.constFloat(val), std::format("(CONSTFLOAT;{})", val));
 	}
 
 	if(auto e = ctx->bool_) {
 		const bool val = WGLUtils::identifier(e) == "true";
-		return EXPRESSION_RESULT(ValueType::Bool, ctx.api->constBool(val), std::format("(CONSTBOOL;{})", val));
+		return EXPRESSION_RESULT(ValueType::Bool, ctx.constBool(val), std::format("(CONSTBOOL;{})", val));
 	}
 
 	if(auto e = ctx->string) {
@@ -617,10 +619,10 @@ WGLExpressionResult WGLImplementationPass::expression(WoglacParser::ExtendedIden
 		}
 
 		case SymbolType::Rule:
-			return EXPRESSION_RESULT(ValueType::Rule, ctx.api->constRule(ctx.map<WGA_Rule>(sym)), std::format("(SYMBOL;{})", std::bit_cast<intptr_t>(sym)));
+			return EXPRESSION_RESULT(ValueType::Rule, ctx.constRule(ctx.map<WGA_Rule>(sym)), std::format("(SYMBOL;{})", std::bit_cast<intptr_t>(sym)));
 
 		case SymbolType::ComponentNode:
-			return EXPRESSION_RESULT(ValueType::ComponentNode, ctx.api->constComponentNode(ctx.map<WGA_ComponentNode>(sym)), std::format("(SYMBOL;{})", std::bit_cast<intptr_t>(sym)));
+			return EXPRESSION_RESULT(ValueType::ComponentNode, ctx.constComponentNode(ctx.map<WGA_ComponentNode>(sym)), std::format("(SYMBOL;{})", std::bit_cast<intptr_t>(sym)));
 
 		default:
 			throw WGLError(std::format("Symbol '{}' of type '{}' cannot be used as a value.", sym->fullName(), WGLUtils::getSymbolTypeName(sym->symbolType())), ctx);
@@ -684,6 +686,7 @@ void WGLImplementationPass::componentNodeCommonPart(WGLSymbol *sym, WoglacParser
 
 	const BlockOrientation orientation = ctx->prop ? BlockOrientation(oriStr(ctx->prop->ori), oriStr(ctx->prop->ori2)) : BlockOrientation();
 
+	deps.insert(component);
 	if(rule)
 		deps.insert(rule);
 
@@ -695,16 +698,16 @@ void WGLImplementationPass::componentNodeCommonPart(WGLSymbol *sym, WoglacParser
 
 		cfgFunc(ctx, cfg);
 
-		WGA_ComponentNode *node = ctx.api->newComponentNode();
-		node->setConfig(cfg);
+		WGA_ComponentNode *node = ctx.newComponentNode();
+		ctx.setComponentNodeConfig(node, cfg);
 
 		for(const auto &ps: pragmaSets)
-			node->setPragma(ps.first, ps.second);
+			ctx.setPragma(node, ps.first, ps.second);
 
 		ctx.addSymbolMapping(sym, node);
 
-		ctx.map<WGA_Component>(component)->addNode(node);
-	});
+		ctx.addNode(ctx.map<WGA_Component>(component), node);
+	}, component);
 }
 
 WGLExpressionResult WGLImplementationPass::functionCall(const std::string &functionName, const std::vector<WGLExpressionResult> &args, antlr4::ParserRuleContext *ctx) {
@@ -726,8 +729,8 @@ WGLExpressionResult WGLImplementationPass::functionCall(const std::string &funct
 	const WorldGenAPI::Function &f = fs.list[fid];
 	return WGLExpressionResult{
 		.func = [fid, args, desc](WGLAPIContext &ctx) {
-			auto r = ctx.api->function(fid, iterator(args).mapx(ctx.expr(x)).toList());
-			r->setDescription(desc);
+			auto r = ctx.function(fid, iterator(args).mapx(ctx.expr(x)).toList());
+			ctx.setDescription(r, desc);
 			return r;
 		},
 		.signature =  std::make_shared<std::string>(std::format("(FUNCCALL;{};{})", prototype, iterator(args).mapx(*x.signature).join(";"))),
@@ -0,0 +1,165 @@
+#include "wglprogram.h"
+
+#include <fstream>
+#include <format>
+#include <filesystem>
+#include <algorithm>
+
+#include "worldgen/base/worldgenapi.h"
+
+namespace {
+	constexpr uint32_t programMagic = 0x504c4757; // "WGLP"
+	constexpr uint32_t programVersion = 3;
+
+	constexpr uint64_t fnvOffsetBasis = 0xcbf29ce484222325ull;
+	constexpr uint64_t fnvPrime = 0x100000001b3ull;
+
+	inline void fnvHash(uint64_t &hash, const char *data, size_t size) {
+		for(size_t i = 0; i < size; i++) {
+			hash ^= static_cast<uint8_t>(data[i]);
+			hash *= fnvPrime;
+		}
+	}
+}
+
+void WGLProgram::save(const std::string &filename) const {
+	std::vector<uint8_t> buf;
+	WGLProgramWriter w(buf);
+
+	w.write(programMagic);
+	w.write(programVersion);
+	w.write(functionsHash());
+
+	w.write(static_cast<uint32_t>(sourceFiles.size()));
+	for(const std::string &f: sourceFiles)
+		w.write(f);
+
+	w.write(static_cast<uint32_t>(files.size()));
+	for(const FileRecord &f: files) {
+		w.write(f.filename);
+		w.write(f.hash);
+	}
+
+	w.write(apiStateHash);
+
+	const std::span<const uint8_t> ops = operations();
+	w.write(static_cast<uint64_t>(ops.size()));
+
+	// Write to a temporary file first so that an interrupted write never leaves a valid-looking program behind
+	const std::string tmpFilename = filename + ".tmp";
+	{
+		std::ofstream f(tmpFilename, std::ios::out | std::ios::binary | std::ios::trunc);
+		f.write(reinterpret_cast<const char *>(buf.data()), buf.size());
+		f.write(reinterpret_cast<const char *>(ops.data()), ops.size());
+
+		if(!f.good())
+			throw std::exception(std::format("Failed to write WOGLAC program file '{}'.", tmpFilename).c_str());
+	}
+
+	std::filesystem::rename(tmpFilename, filename);
+}
+
+bool WGLProgram::load(const std::string &filename, const std::vector<std::string> &sourceFiles, const StreamFunction &streamFunction) {
+	if(!std::filesystem::exists(filename))
+		return false;
+
+	try {
+		auto mf = std::make_unique<MappedFile>(filename);
+		WGLProgramReader r(std::span<const uint8_t>(mf->data(), mf->size()));
+
+		if(r.read<uint32_t>() != programMagic || r.read<uint32_t>() != programVersion || r.read<uint64_t>() != functionsHash())
+			return false;
+
+		std::vector<std::string> srcs(r.read<uint32_t>());
+		for(std::string &f: srcs)
+			f = r.read<std::string>();
+
+		if(srcs != sourceFiles)
+			return false;
+
+		std::vector<FileRecord> fls(r.read<uint32_t>());
+		for(FileRecord &f: fls) {
+			f.filename = r.read<std::string>();
+			f.hash = r.read<uint64_t>();
+		}
+
+		// Check that the sources have not changed since the program was compiled
+		for(const FileRecord &f: fls) {
+			if(hashStream(*streamFunction(f.filename)) != f.hash)
+				return false;
+		}
+
+		const uint64_t stateHash = r.read<uint64_t>();
+
+		const uint64_t opsSize = r.read<uint64_t>();
+		const uint8_t *ops = r.pos();
+		r.skip(opsSize);
+
+		if(!r.atEnd())
+			return false;
+
+		this->sourceFiles = std::move(srcs);
+		files = std::move(fls);
+		apiStateHash = stateHash;
+		data.clear();
+
+		mappedFile_ = std::move(mf);
+		mappedOperations_ = ops;
+		mappedOperationsSize_ = opsSize;
+	}
+	catch(const std::exception &) {
+		// Corrupted file or missing source -> treat as outdated
+		return false;
+	}
+
+	return true;
+}
+
+uint64_t WGLProgram::hashStream(std::istream &stream) {
+	uint64_t result = fnvOffsetBasis;
+
+	char buf[4096];
+	while(stream.read(buf, sizeof(buf)) || stream.gcount())
+		fnvHash(result, buf, stream.gcount());
+
+	return result;
+}
+
+uint64_t WGLProgram::hashData(std::string_view data) {
+	uint64_t result = fnvOffsetBasis;
+	fnvHash(result, data.data(), data.size());
+	return result;
+}
+
+uint64_t WGLProgram::functionsHash() {
+	static const uint64_t result = [] {
+		uint64_t r = fnvOffsetBasis;
+
+		for(const WorldGenAPI::Function &f: WorldGenAPI::functions().list) {
+			const std::string str = std::format("{}:{}:{};", f.id, f.prototype, static_cast<int>(f.returnValue.type));
+			fnvHash(r, str.data(), str.size());
+		}
+
+		return r;
+	}();
+
+	return result;
+}
+
+uint64_t WGLProgram::apiHash(const WorldGenAPI &api) {
+	uint64_t r = fnvOffsetBasis;
+
+	const WorldGenSeed seed = api.seed();
+	fnvHash(r, reinterpret_cast<const char *>(&seed), sizeof(seed));
+
+	// Sort the mapping so that the hash does not depend on the hash map order
+	std::vector<std::pair<std::string, BlockID>> blockMapping(api.blockUIDMapping().begin(), api.blockUIDMapping().end());
+	std::sort(blockMapping.begin(), blockMapping.end());
+
+	for(const auto &[uid, id]: blockMapping) {
+		const std::string str = std::format("{}:{};", uid, id);
+		fnvHash(r, str.data(), str.size());
+	}
+
+	return r;
+}
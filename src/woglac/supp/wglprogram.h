@@ -0,0 +1,146 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <span>
+#include <functional>
+#include <istream>
+
+#include "util/mappedfile.h"
+
+class WorldGenAPI;
+
+/// Compiled WOGLAC program - serialized list of WGLAPIContext operations that construct the worldgen pipeline.
+/// Can be saved to a file and loaded on the next start to skip the compilation altogether.
+class WGLProgram {
+
+public:
+	using StreamFunction = std::function<std::unique_ptr<std::istream>(const std::string &filename)>;
+
+	struct FileRecord {
+		std::string filename;
+		uint64_t hash;
+	};
+
+public:
+	/// Source files the program was compiled from (in the order they were provided)
+	std::vector<std::string> sourceFiles;
+
+	/// All files the compilation used (source files, vox files) with their content hashes
+	std::vector<FileRecord> files;
+
+	/// Hash of the API state the program was constructed with (see #apiHash); constant folding and deduplication depend on it
+	uint64_t apiStateHash = 0;
+
+	/// Serialized operations of a program that is being recorded
+	std::vector<uint8_t> data;
+
+public:
+	/// Serialized operations - either recorded or memory mapped from a loaded file
+	inline std::span<const uint8_t> operations() const {
+		return mappedFile_ ? std::span<const uint8_t>(mappedOperations_, mappedOperationsSize_) : std::span<const uint8_t>(data);
+	}
+
+public:
+	void save(const std::string &filename) const;
+
+	/// Loads the program from the file (using memory mapping).
+	/// Returns false if the file does not exist, is not compatible with the current build or if it is not up to date with the sources (checked using #streamFunction).
+	bool load(const std::string &filename, const std::vector<std::string> &sourceFiles, const StreamFunction &streamFunction);
+
+public:
+	static uint64_t hashStream(std::istream &stream);
+	static uint64_t hashData(std::string_view data);
+
+	/// Hash of the WorldGenAPI function list; programs are not compatible between builds with different function lists
+	static uint64_t functionsHash();
+
+	/// Hash of the WorldGenAPI state that affects the construction (seed, block UID mapping)
+	static uint64_t apiHash(const WorldGenAPI &api);
+
+private:
+	std::unique_ptr<MappedFile> mappedFile_;
+	const uint8_t *mappedOperations_ = nullptr;
+	size_t mappedOperationsSize_ = 0;
+
+};
+
+/// Helper for serializing the program
+class WGLProgramWriter {
+
+public:
+	inline WGLProgramWriter(std::vector<uint8_t> &data) : data_(data) {}
+
+public:
+	template<typename T>
+	void write(const T &v) {
+		if constexpr(std::is_same_v<T, std::string>) {
+			write(static_cast<uint32_t>(v.size()));
+			data_.insert(data_.end(), v.begin(), v.end());
+		}
+		else {
+			static_assert(std::is_trivially_copyable_v<T>);
+
+			const uint8_t *ptr = reinterpret_cast<const uint8_t *>(&v);
+			data_.insert(data_.end(), ptr, ptr + sizeof(T));
+		}
+	}
+
+private:
+	std::vector<uint8_t> &data_;
+
+};
+
+/// Helper for deserializing the program, throws std::exception when reading out of bounds
+class WGLProgramReader {
+
+public:
+	inline WGLProgramReader(std::span<const uint8_t> data) : pos_(data.data()), end_(data.data() + data.size()) {}
+
+public:
+	inline bool atEnd() const {
+		return pos_ == end_;
+	}
+
+	inline const uint8_t *pos() const {
+		return pos_;
+	}
+
+	template<typename T>
+	T read() {
+		if constexpr(std::is_same_v<T, std::string>) {
+			const uint32_t size = read<uint32_t>();
+			require(size);
+
+			std::string result(reinterpret_cast<const char *>(pos_), size);
+			pos_ += size;
+			return result;
+		}
+		else {
+			static_assert(std::is_trivially_copyable_v<T>);
+			require(sizeof(T));
+
+			T result;
+			std::memcpy(&result, pos_, sizeof(T));
+			pos_ += sizeof(T);
+			return result;
+		}
+	}
+
+	inline void skip(size_t size) {
+		require(size);
+		pos_ += size;
+	}
+
+private:
+	inline void require(size_t size) const {
+		if(static_cast<size_t>(end_ - pos_) < size)
+			throw std::exception("Corrupted WOGLAC program data.");
+	}
+
+private:
+	const uint8_t *pos_, *end_;
+
+};
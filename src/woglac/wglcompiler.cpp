@@ -2,7 +2,11 @@
 #include "supp/wglinclude.h"
 
 #include <fstream>
+#include <sstream>
 #include <format>
+#include <thread>
+#include <atomic>
+#include <optional>
 
 #include "util/iterators.h"
 
@@ -13,6 +17,7 @@
 #include "supp/wglerror.h"
 #include "supp/wgldeclarationpass.h"
 #include "supp/wglimplementationpass.h"
+#include "supp/wglprogram.h"
 
 class ANTLRErrorHandler : public antlr4::BaseErrorListener {
 	virtual void syntaxError(antlr4::Recognizer *recognizer, antlr4::Token *offendingSymbol, size_t line, size_t charPositionInLine, const std::string &msg, std::exception_ptr e) override {
@@ -29,6 +34,9 @@ WGLCompiler::WGLCompiler() {
 void WGLCompiler::clear() {
 	modules_.clear();
 	context_->clear();
+	usedFiles_.clear();
+	program_.reset();
+	isProgramLoaded_ = false;
 }
 
 void WGLCompiler::addSourceFile(const std::string &file) {
@@ -40,7 +48,14 @@ std::unique_ptr<std::istream> WGLCompiler::getFileStream(const std::string &file
 		throw std::exception("Stream function not set !");
 
 	try {
-		return streamFunction_(filename);
+		// Read the whole file so that the hash matches exactly what is compiled (the file can change before the program is saved)
+		auto stream = streamFunction_(filename);
+		std::string data((std::istreambuf_iterator<char>(*stream)), std::istreambuf_iterator<char>());
+
+		if(std::find_if(usedFiles_.begin(), usedFiles_.end(), [&](const WGLProgram::FileRecord &f) { return f.filename == filename; }) == usedFiles_.end())
+			usedFiles_.push_back(WGLProgram::FileRecord{filename, WGLProgram::hashData(data)});
+
+		return std::make_unique<std::istringstream>(std::move(data));
 	}
 	catch(const std::exception &e) {
 		if(ctx)
@@ -56,29 +71,73 @@ void WGLCompiler::compile() {
 	try {
 
 		// Parse files
-		for(const std::string &s: sourceFiles_) {
-			try {
+		{
+			// Open the streams on this thread (getFileStream is not thread safe), parse in parallel. ANTLR runtime shares the ATN/DFA caches between parser instances in a thread safe way.
+			for(const std::string &s: sourceFiles_) {
 				auto m = std::make_shared<WGLModule>();
 				m->stream = getFileStream(s, nullptr);
+				modules_.push_back(m);
+			}
 
-				m->input.reset(new antlr4::ANTLRInputStream(*m->stream));
-				m->lexer.reset(new WoglacLexer(m->input.get()));
-				m->tokens.reset(new antlr4::CommonTokenStream(m->lexer.get()));
-				m->parser.reset(new WoglacParser(m->tokens.get()));
+			const auto parse = [](WGLModule &m) {
+				m.input.reset(new antlr4::ANTLRInputStream(*m.stream));
+				m.lexer.reset(new WoglacLexer(m.input.get()));
+				m.tokens.reset(new antlr4::CommonTokenStream(m.lexer.get()));
+				m.parser.reset(new WoglacParser(m.tokens.get()));
 
-				m->parser->setBuildParseTree(true);
-				m->parser->getInterpreter<antlr4::atn::ParserATNSimulator>()->setPredictionMode(antlr4::atn::PredictionMode::SLL);
+				m.parser->setBuildParseTree(true);
+				m.parser->getInterpreter<antlr4::atn::ParserATNSimulator>()->setPredictionMode(antlr4::atn::PredictionMode::SLL);
 
 				ANTLRErrorHandler errHandler;
-				m->parser->removeErrorListeners();
-				m->parser->addErrorListener(&errHandler);
-				m->ast = m->parser->module();
-
-				modules_.push_back(m);
-			}
-			catch(const WGLError &e) {
-				throw std::exception(std::format("Error when compiling WOGLAC source '{}': {}", s, e.message()).c_str());
+				m.parser->removeErrorListeners();
+				m.parser->addErrorListener(&errHandler);
+				m.ast = m.parser->module();
+			};
+
+			// Fixed number of workers picking up the modules until there are none left
+			std::vector<std::exception_ptr> exceptions(modules_.size());
+			std::atomic<size_t> nextIx = 0;
+			const auto work = [&] {
+				while(true) {
+					const size_t i = nextIx++;
+					if(i >= modules_.size())
+						return;
+
+					try {
+						parse(*modules_[i]);
+					}
+					catch(...) {
+						exceptions[i] = std::current_exception();
+					}
+				}
+			};
+
+			const size_t workerCount = std::min<size_t>(modules_.size(), std::max<size_t>(std::thread::hardware_concurrency(), 1));
+			std::vector<std::thread> helpers;
+			for(size_t i = 1; i < workerCount; i++)
+				helpers.push_back(std::thread(work));
+
+			work();
+
+			for(std::thread &t: helpers)
+				t.join();
+
+			// Report the first error in the source file order
+			std::optional<std::string> error;
+			for(size_t i = 0; i < exceptions.size() && !error; i++) {
+				if(!exceptions[i])
+					continue;
+
+				try {
+					std::rethrow_exception(exceptions[i]);
+				}
+				catch(const WGLError &e) {
+					error = std::format("Error when compiling WOGLAC source '{}': {}", sourceFiles_[i], e.message());
+				}
 			}
+
+			if(error)
+				throw std::exception(error->c_str());
 		}
 
 		// Declaration pass
@@ -106,16 +165,48 @@ void WGLCompiler::compile() {
 	}
 }
 
+bool WGLCompiler::loadProgram(const std::string &filename) {
+	clear();
+
+	auto program = std::make_shared<WGLProgram>();
+	if(!program->load(filename, sourceFiles_, streamFunction_))
+		return false;
+
+	program_ = program;
+	isProgramLoaded_ = true;
+	return true;
+}
+
+void WGLCompiler::saveProgram(const std::string &filename) {
+	if(!program_)
+		throw std::exception("No program to save (construct not called).");
+
+	program_->sourceFiles = sourceFiles_;
+	program_->files = usedFiles_;
+	program_->save(filename);
+}
+
 std::unordered_map<std::string, WGA_Value *> WGLCompiler::construct(WorldGenAPI &api) {
 	WGLAPIContext ctx;
 	ctx.api = &api;
 
-	for(const auto &cmd: context_->apiCommands())
-		cmd(ctx);
+	if(isProgramLoaded_) {
+		if(program_->apiStateHash == WGLProgram::apiHash(api)) {
+			ctx.replay(*program_);
+			return ctx.exports();
+		}
+
+		// The program was constructed with a different seed/block mapping -> the recorded symbol deduplication and constant folding would not match
+		compile();
+	}
 
-	std::unordered_map<std::string, WGA_Value *> r;
+	program_ = std::make_shared<WGLProgram>();
+	program_->apiStateHash = WGLProgram::apiHash(api);
+	ctx.recordProgram = program_.get();
+
+	std::vector<WGLSymbol *> exports;
 	for(const auto &i: context_->rootSymbol->childrenByName()) {
-		const WGLSymbol *sym = i.second;
+		WGLSymbol *sym = i.second;
 
 		if(!sym->isExport)
 			continue;
@@ -123,8 +214,22 @@ std::unordered_map<std::string, WGA_Value *> WGLCompiler::construct(WorldGenAPI
 		if(sym->symbolType() != WGLSymbol::Type::FieldVariable)
 			continue;
 
-		r[sym->name()] = ctx.map<WGA_Value>(sym);
+		exports.push_back(sym);
+	}
+
+	// Only construct what can be sampled - exports and everything they use (structures included).
+	// Biomes are global (all of them participate in the biome selection), so they are always constructed.
+	std::vector<WGLSymbol *> roots = exports;
+	for(WGLSymbol *sym: context_->allSymbols) {
+		if(sym->symbolType() == WGLSymbol::Type::Biome || sym->symbolType() == WGLSymbol::Type::BiomeParam)
+			roots.push_back(sym);
 	}
 
-	return r;
+	for(const auto &cmd: context_->reachableApiCommands(roots))
+		cmd(ctx);
+
+	for(const WGLSymbol *sym: exports)
+		ctx.addExport(sym->name(), ctx.map<WGA_Value>(sym));
+
+	return ctx.exports();
 }
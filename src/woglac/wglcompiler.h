@@ -6,6 +6,8 @@
 
 #include "pch.h"
 
+#include "woglac/supp/wglprogram.h"
+
 // Woglac language parser and compiler, outputs a
 class WGLCompiler {
 
@@ -31,6 +33,18 @@ public:
 public:
 	void compile();
 
+	/// Loads a precompiled program (saved by saveProgram) instead of compiling the source files.
+	/// Returns false if the program file does not exist or is out of date, in which case compile() has to be called.
+	bool loadProgram(const std::string &filename);
+
+	/// Saves the program constructed by the last construct() call, so that it can be loaded using loadProgram on the next run
+	void saveProgram(const std::string &filename);
+
+	/// True if the pipeline is constructed from a loaded program (false if the program was recompiled, e.g. because it was built for a different seed or block mapping)
+	inline bool isProgramLoaded() const {
+		return isProgramLoaded_;
+	}
+
 public:
 	// Calls appropriate WorldGenAPI functions to construct the worldgen pipeline, returns exports
 	std::unordered_map<std::string, WGA_Value *> construct(WorldGenAPI &api);
@@ -40,6 +54,13 @@ private:
 	std::shared_ptr<WGLContext> context_;
 	StreamFunction streamFunction_;
 
+	/// All files opened during the compilation (source files, vox files) with the hashes of the contents that were compiled
+	std::vector<WGLProgram::FileRecord> usedFiles_;
+
+	/// Either loaded or recorded during construct()
+	std::shared_ptr<WGLProgram> program_;
+	bool isProgramLoaded_ = false;
+
 private:
 	std::vector<std::shared_ptr<WGLModule>> modules_;
 
@@ -1,16 +1,26 @@
 #include "wga_grammarsymbol.h"
 
+#include <format>
+
 
 WGA_GrammarSymbol::WGA_GrammarSymbol() {
 
 }
 
+WGA_GrammarSymbol::ParamID WGA_GrammarSymbol::paramID(const std::string &paramName, WGA_Value::ValueType type) {
+	static std::unordered_map<std::string, ParamID> ids;
+
+	const std::string key = std::format("{}#{}", paramName, WGA_Value::typeNames.at(type));
+	return ids.try_emplace(key, static_cast<ParamID>(ids.size())).first->second;
+}
+
 void WGA_GrammarSymbol::setParam(const std::string &param, WGA_Value *value) {
-	paramSets_.push_back({param, value});
+	paramSets_.push_back({param, value, paramID(param, value->valueType())});
 }
 
 void WGA_GrammarSymbol::declareParam(const WGA_GrammarSymbol::ParamDeclare &param) {
-	paramDeclares_.push_back(param);
+	ParamDeclare &pd = paramDeclares_.emplace_back(param);
+	pd.paramID = paramID(pd.paramName, pd.type);
 }
 
 void WGA_GrammarSymbol::addCondition(const WGA_GrammarSymbol::Condition &cond) {
@@ -19,3 +29,27 @@ void WGA_GrammarSymbol::addCondition(const WGA_GrammarSymbol::Condition &cond) {
 
 	conditions_.push_back(cond);
 }
+
+const WGA_GrammarSymbol::CompiledConditions &WGA_GrammarSymbol::compiledConditions(const std::function<bool(WGA_Value *)> &evaluate) {
+	if(compiledConditionsReady_.load(std::memory_order_acquire))
+		return compiledConditions_;
+
+	// Evaluate outside of the lock - evaluate samples data records, which can take long (and could need other workers to finish).
+	// Multiple threads can compile the conditions at the same time, only the first result is published.
+	CompiledConditions result;
+	for(const Condition &cond: conditions_) {
+		// Non-contextual constant values are the same for all positions and all structures
+		if(!cond.value->isContextual() && cond.value->dimensionality() == WGA_Value::Dimensionality::DConst)
+			result.staticResult = result.staticResult && evaluate(cond.value);
+		else
+			result.dynamicConditions.push_back(cond);
+	}
+
+	std::unique_lock _ml(compilingConditionsMutex_);
+	if(!compiledConditionsReady_.load(std::memory_order_relaxed)) {
+		compiledConditions_ = std::move(result);
+		compiledConditionsReady_.store(true, std::memory_order_release);
+	}
+
+	return compiledConditions_;
+}
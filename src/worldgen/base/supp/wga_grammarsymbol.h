@@ -3,30 +3,51 @@
 #include <vector>
 #include <unordered_map>
 #include <variant>
+#include <mutex>
+#include <atomic>
+#include <functional>
 
 #include "wga_symbol.h"
 #include "wga_value.h"
+#include "util/tracyutils.h"
 
 class WGA_GrammarSymbol : public WGA_Symbol {
 
 public:
+	/// Dense integer identifying (param name, value type) pair, see paramID()
+	using ParamID = int;
+
 	struct ParamSet {
 		std::string paramName;
 		WGA_Value *value = nullptr;
+		ParamID paramID = -1; ///< Filled in by setParam
 	};
 	struct ParamDeclare {
 		std::string paramName;
 		WGA_Value::ValueType type = WGA_Value::ValueType::Undefined;
 		WGA_Value *value = nullptr;
 		WGA_Value *defaultValue = nullptr;
+		ParamID paramID = -1; ///< Filled in by declareParam
 	};
 	struct Condition {
 		WGA_Value *value = nullptr;
 	};
+	struct CompiledConditions {
+		/// Result of all conditions that depend neither on the position nor on the structure context (evaluated only once)
+		bool staticResult = true;
+
+		/// Conditions that have to be evaluated for each expansion
+		std::vector<Condition> dynamicConditions;
+	};
 
 public:
 	WGA_GrammarSymbol();
 
+public:
+	/// Interns the (param name, value type) pair into a dense integer id. Params only match when both name and type match.
+	/// Only to be called during the pipeline construction (not thread safe).
+	static ParamID paramID(const std::string &paramName, WGA_Value::ValueType type);
+
 public:
 	void setParam(const std::string &param, WGA_Value *value);
 
@@ -47,8 +68,14 @@ public:
 
 	void addCondition(const Condition &cond);
 
+	/// Splits the conditions to static and dynamic ones on the first call; static conditions are evaluated using the evaluate function
+	const CompiledConditions &compiledConditions(const std::function<bool(WGA_Value *)> &evaluate);
+
 private:
 	std::vector<Condition> conditions_;
+	CompiledConditions compiledConditions_;
+	std::atomic<bool> compiledConditionsReady_ = false;
+	TracyLockable(std::mutex, compilingConditionsMutex_);
 	std::vector<ParamSet> paramSets_;
 	std::vector<ParamDeclare> paramDeclares_;
 	std::unordered_map<std::string, std::variant<float, std::string>> setPragmas_;
@@ -154,6 +154,10 @@ public:
 	/// Returns value representing given grammar symbol param.
 	virtual WGA_Value *grammarSymbolParam(WGA_GrammarSymbol *sym, const std::string &name, WGA_Value::ValueType type, WGA_Value *defaultValue) = 0;
 
+	/// Evaluates #v during the compilation if possible (#v is constant and not contextual).
+	/// Returns const value with the evaluated result or nullptr if #v cannot be folded.
+	virtual WGA_Value *constFold(WGA_Value *v) = 0;
+
 private:
 	WorldGenSeed seed_ = 0;
 	std::unordered_map<std::string, BlockID> blockUIDMapping_;
@@ -23,6 +23,9 @@
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						
 
@@ -44,7 +47,7 @@ if(std::rand() & 1) {
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "worldPos")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "worldPos"), hasStaticDimensionality));
 					};
 
 					result[1] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -53,6 +56,9 @@ if(std::rand() & 1) {
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -70,7 +76,7 @@ Arg2 argv2 = Arg2(args[1]);
 Arg3 argv3 = Arg3(args[2]);
 return WGA_UtilityFuncs_CPU::select(api, key, data , argv1, argv2, argv3);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "select")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "select"), hasStaticDimensionality));
 					};
 
 					result[2] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -79,6 +85,9 @@ return WGA_UtilityFuncs_CPU::select(api, key, data , argv1, argv2, argv3);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -96,7 +105,7 @@ Arg2 argv2 = Arg2(args[1]);
 Arg3 argv3 = Arg3(args[2]);
 return WGA_UtilityFuncs_CPU::select(api, key, data , argv1, argv2, argv3);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "select")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "select"), hasStaticDimensionality));
 					};
 
 					result[3] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -105,6 +114,9 @@ return WGA_UtilityFuncs_CPU::select(api, key, data , argv1, argv2, argv3);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -122,7 +134,7 @@ Arg2 argv2 = Arg2(args[1]);
 Arg3 argv3 = Arg3(args[2]);
 return WGA_UtilityFuncs_CPU::select(api, key, data , argv1, argv2, argv3);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "select")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "select"), hasStaticDimensionality));
 					};
 
 					result[4] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -131,6 +143,9 @@ return WGA_UtilityFuncs_CPU::select(api, key, data , argv1, argv2, argv3);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
@@ -148,7 +163,7 @@ Arg2 argv2 = Arg2(args[1]);
 Arg3 argv3 = Arg3(args[2]);
 return WGA_UtilityFuncs_CPU::select(api, key, data , argv1, argv2, argv3);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "select")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "select"), hasStaticDimensionality));
 					};
 
 					result[5] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -157,6 +172,9 @@ return WGA_UtilityFuncs_CPU::select(api, key, data , argv1, argv2, argv3);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
@@ -174,7 +192,7 @@ Arg2 argv2 = Arg2(args[1]);
 Arg3 argv3 = Arg3(args[2]);
 return WGA_UtilityFuncs_CPU::select(api, key, data , argv1, argv2, argv3);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "select")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "select"), hasStaticDimensionality));
 					};
 
 					result[6] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -183,6 +201,9 @@ return WGA_UtilityFuncs_CPU::select(api, key, data , argv1, argv2, argv3);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
@@ -200,7 +221,7 @@ Arg2 argv2 = Arg2(args[1]);
 Arg3 argv3 = Arg3(args[2]);
 return WGA_UtilityFuncs_CPU::select(api, key, data , argv1, argv2, argv3);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "select")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "select"), hasStaticDimensionality));
 					};
 
 					result[7] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -209,6 +230,9 @@ return WGA_UtilityFuncs_CPU::select(api, key, data , argv1, argv2, argv3);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
@@ -226,7 +250,7 @@ Arg2 argv2 = Arg2(args[1]);
 Arg3 argv3 = Arg3(args[2]);
 return WGA_UtilityFuncs_CPU::select(api, key, data , argv1, argv2, argv3);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "select")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "select"), hasStaticDimensionality));
 					};
 
 					result[8] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -235,6 +259,9 @@ return WGA_UtilityFuncs_CPU::select(api, key, data , argv1, argv2, argv3);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -268,7 +295,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "float2")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "float2"), hasStaticDimensionality));
 					};
 
 					result[9] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -277,6 +304,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -304,7 +334,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "float2")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "float2"), hasStaticDimensionality));
 					};
 
 					result[10] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -313,6 +343,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -352,7 +385,7 @@ const Arg3::T arg3 = argh3[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "float3")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "float3"), hasStaticDimensionality));
 					};
 
 					result[11] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -361,6 +394,9 @@ const Arg3::T arg3 = argh3[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -394,7 +430,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "float3")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "float3"), hasStaticDimensionality));
 					};
 
 					result[12] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -403,6 +439,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -430,7 +469,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "float3")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "float3"), hasStaticDimensionality));
 					};
 
 					result[13] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -439,6 +478,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -466,7 +508,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "x")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "x"), hasStaticDimensionality));
 					};
 
 					result[14] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -475,6 +517,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -502,7 +547,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "x")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "x"), hasStaticDimensionality));
 					};
 
 					result[15] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -511,6 +556,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -538,7 +586,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "y")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "y"), hasStaticDimensionality));
 					};
 
 					result[16] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -547,6 +595,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -574,7 +625,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "y")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "y"), hasStaticDimensionality));
 					};
 
 					result[17] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -583,6 +634,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -610,7 +664,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "z")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "z"), hasStaticDimensionality));
 					};
 
 					result[18] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -619,6 +673,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -646,7 +703,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "xy")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "xy"), hasStaticDimensionality));
 					};
 
 					result[19] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -655,6 +712,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -682,7 +742,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "normalize")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "normalize"), hasStaticDimensionality));
 					};
 
 					result[20] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -691,6 +751,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -718,7 +781,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "normalize")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "normalize"), hasStaticDimensionality));
 					};
 
 					result[21] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -727,6 +790,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -754,7 +820,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "length")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "length"), hasStaticDimensionality));
 					};
 
 					result[22] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -763,6 +829,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -790,7 +859,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "length")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "length"), hasStaticDimensionality));
 					};
 
 					result[23] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -799,6 +868,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -814,7 +886,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_UtilityFuncs_CPU::lengthExp(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "lengthExp")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "lengthExp"), hasStaticDimensionality));
 					};
 
 					result[24] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -823,6 +895,9 @@ return WGA_UtilityFuncs_CPU::lengthExp(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -838,7 +913,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_UtilityFuncs_CPU::lengthExp(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "lengthExp")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "lengthExp"), hasStaticDimensionality));
 					};
 
 					result[25] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -847,6 +922,9 @@ return WGA_UtilityFuncs_CPU::lengthExp(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -874,7 +952,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "manhattanLength")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "manhattanLength"), hasStaticDimensionality));
 					};
 
 					result[26] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -883,6 +961,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -910,7 +991,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "manhattanLength")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "manhattanLength"), hasStaticDimensionality));
 					};
 
 					result[27] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -919,6 +1000,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -952,7 +1036,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "distance")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "distance"), hasStaticDimensionality));
 					};
 
 					result[28] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -961,6 +1045,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -994,7 +1081,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "distance")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "distance"), hasStaticDimensionality));
 					};
 
 					result[29] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1003,6 +1090,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -1036,7 +1126,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "manhattanDistance")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "manhattanDistance"), hasStaticDimensionality));
 					};
 
 					result[30] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1045,6 +1135,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1078,7 +1171,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "manhattanDistance")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "manhattanDistance"), hasStaticDimensionality));
 					};
 
 					result[31] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1087,6 +1180,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -1114,7 +1210,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "distanceTo")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "distanceTo"), hasStaticDimensionality));
 					};
 
 					result[32] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1123,6 +1219,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -1150,7 +1249,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "distanceTo")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "distanceTo"), hasStaticDimensionality));
 					};
 
 					result[33] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1159,6 +1258,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -1186,7 +1288,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "distanceTo2D")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "distanceTo2D"), hasStaticDimensionality));
 					};
 
 					result[34] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1195,6 +1297,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1212,7 +1317,7 @@ Arg2 argv2 = Arg2(args[1]);
 Arg3 argv3 = Arg3(args[2]);
 return WGA_UtilityFuncs_CPU::distanceToLine(api, key, data , argv1, argv2, argv3);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "distanceToLine")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "distanceToLine"), hasStaticDimensionality));
 					};
 
 					result[35] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1221,6 +1326,9 @@ return WGA_UtilityFuncs_CPU::distanceToLine(api, key, data , argv1, argv2, argv3
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1236,7 +1344,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleOffset(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleOffset")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleOffset"), hasStaticDimensionality));
 					};
 
 					result[36] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1245,6 +1353,9 @@ return WGA_SamplingFuncs_CPU::sampleOffset(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1260,7 +1371,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleOffset(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleOffset")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleOffset"), hasStaticDimensionality));
 					};
 
 					result[37] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1269,6 +1380,9 @@ return WGA_SamplingFuncs_CPU::sampleOffset(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1284,7 +1398,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleOffset(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleOffset")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleOffset"), hasStaticDimensionality));
 					};
 
 					result[38] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1293,6 +1407,9 @@ return WGA_SamplingFuncs_CPU::sampleOffset(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1308,7 +1425,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleOffset(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleOffset")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleOffset"), hasStaticDimensionality));
 					};
 
 					result[39] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1317,6 +1434,9 @@ return WGA_SamplingFuncs_CPU::sampleOffset(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1332,7 +1452,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleOffset(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleOffset")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleOffset"), hasStaticDimensionality));
 					};
 
 					result[40] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1341,6 +1461,9 @@ return WGA_SamplingFuncs_CPU::sampleOffset(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1356,7 +1479,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleOffset(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleOffset")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleOffset"), hasStaticDimensionality));
 					};
 
 					result[41] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1365,6 +1488,9 @@ return WGA_SamplingFuncs_CPU::sampleOffset(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1380,7 +1506,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleOffset(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleOffset")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleOffset"), hasStaticDimensionality));
 					};
 
 					result[42] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1389,6 +1515,9 @@ return WGA_SamplingFuncs_CPU::sampleOffset(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1404,7 +1533,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[43] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1413,6 +1542,9 @@ return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1428,7 +1560,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[44] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1437,6 +1569,9 @@ return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1452,7 +1587,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[45] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1461,6 +1596,9 @@ return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1476,7 +1614,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[46] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1485,6 +1623,9 @@ return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1500,7 +1641,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[47] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1509,6 +1650,9 @@ return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1524,7 +1668,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[48] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1533,6 +1677,9 @@ return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -1548,7 +1695,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[49] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1557,6 +1704,9 @@ return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -1572,7 +1722,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[50] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1581,6 +1731,9 @@ return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -1596,7 +1749,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[51] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1605,6 +1758,9 @@ return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -1620,7 +1776,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[52] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1629,6 +1785,9 @@ return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -1644,7 +1803,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[53] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1653,6 +1812,9 @@ return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -1668,7 +1830,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[54] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1677,6 +1839,9 @@ return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -1692,7 +1857,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[55] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1701,6 +1866,9 @@ return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -1716,7 +1884,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[56] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1725,6 +1893,9 @@ return WGA_SamplingFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -1740,7 +1911,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleGradient2D(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleGradient2D")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleGradient2D"), hasStaticDimensionality));
 					};
 
 					result[57] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1749,6 +1920,9 @@ return WGA_SamplingFuncs_CPU::sampleGradient2D(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -1764,7 +1938,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAvg2D(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAvg2D")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAvg2D"), hasStaticDimensionality));
 					};
 
 					result[58] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1773,6 +1947,9 @@ return WGA_SamplingFuncs_CPU::sampleAvg2D(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -1788,7 +1965,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAvg2D(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAvg2D")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAvg2D"), hasStaticDimensionality));
 					};
 
 					result[59] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1797,6 +1974,9 @@ return WGA_SamplingFuncs_CPU::sampleAvg2D(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -1812,7 +1992,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_SamplingFuncs_CPU::sampleAvg2D(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAvg2D")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAvg2D"), hasStaticDimensionality));
 					};
 
 					result[60] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1821,6 +2001,9 @@ return WGA_SamplingFuncs_CPU::sampleAvg2D(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -1834,7 +2017,7 @@ return WGA_SamplingFuncs_CPU::sampleAvg2D(api, key, data , argv1, argv2);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_nearest")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_nearest"), hasStaticDimensionality));
 					};
 
 					result[61] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1843,6 +2026,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -1856,7 +2042,7 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_nearest")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_nearest"), hasStaticDimensionality));
 					};
 
 					result[62] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1865,6 +2051,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -1878,7 +2067,7 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_nearest")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_nearest"), hasStaticDimensionality));
 					};
 
 					result[63] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1887,6 +2076,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 
@@ -1900,7 +2092,7 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_nearest")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_nearest"), hasStaticDimensionality));
 					};
 
 					result[64] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1909,6 +2101,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 
@@ -1922,7 +2117,7 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_nearest")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_nearest"), hasStaticDimensionality));
 					};
 
 					result[65] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1931,6 +2126,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 
@@ -1944,7 +2142,7 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_nearest")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_nearest"), hasStaticDimensionality));
 					};
 
 					result[66] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1953,6 +2151,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 
@@ -1966,7 +2167,7 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_nearest")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_nearest"), hasStaticDimensionality));
 					};
 
 					result[67] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1975,6 +2176,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -1988,7 +2192,7 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearest(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_nearestSet")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_nearestSet"), hasStaticDimensionality));
 					};
 
 					result[68] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -1997,6 +2201,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -2010,7 +2217,7 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_nearestSet")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_nearestSet"), hasStaticDimensionality));
 					};
 
 					result[69] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2019,6 +2226,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -2032,7 +2242,7 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_nearestSet")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_nearestSet"), hasStaticDimensionality));
 					};
 
 					result[70] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2041,6 +2251,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 
@@ -2054,7 +2267,7 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_nearestSet")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_nearestSet"), hasStaticDimensionality));
 					};
 
 					result[71] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2063,6 +2276,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 
@@ -2076,7 +2292,7 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_nearestSet")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_nearestSet"), hasStaticDimensionality));
 					};
 
 					result[72] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2085,6 +2301,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 
@@ -2098,7 +2317,7 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_nearestSet")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_nearestSet"), hasStaticDimensionality));
 					};
 
 					result[73] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2107,6 +2326,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 
@@ -2120,7 +2342,7 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_nearestSet")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_nearestSet"), hasStaticDimensionality));
 					};
 
 					result[74] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2129,6 +2351,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_nearestSet(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -2144,7 +2369,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_BiomeFuncs_CPU::biomeParam_weighted(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_weighted")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_weighted"), hasStaticDimensionality));
 					};
 
 					result[75] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2153,6 +2378,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_weighted(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -2168,7 +2396,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_BiomeFuncs_CPU::biomeParam_weighted(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_weighted")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_weighted"), hasStaticDimensionality));
 					};
 
 					result[76] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2177,6 +2405,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_weighted(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -2192,7 +2423,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_BiomeFuncs_CPU::biomeParam_weighted(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "biomeParam_weighted")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "biomeParam_weighted"), hasStaticDimensionality));
 					};
 
 					result[77] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2201,6 +2432,9 @@ return WGA_BiomeFuncs_CPU::biomeParam_weighted(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -2222,7 +2456,7 @@ Arg4 argv4 = Arg4(args[3]);
 Arg5 argv5 = Arg5(args[4]);
 return WGA_StructureFuncs_CPU::spawn2D(api, key, data , argv1, argv2, argv3, argv4, argv5);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "spawn2D")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "spawn2D"), hasStaticDimensionality));
 					};
 
 					result[78] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2231,6 +2465,9 @@ return WGA_StructureFuncs_CPU::spawn2D(api, key, data , argv1, argv2, argv3, arg
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 
@@ -2244,7 +2481,7 @@ return WGA_StructureFuncs_CPU::spawn2D(api, key, data , argv1, argv2, argv3, arg
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_StructureFuncs_CPU::worldPos(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "worldPos")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "worldPos"), hasStaticDimensionality));
 					};
 
 					result[79] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2253,6 +2490,9 @@ return WGA_StructureFuncs_CPU::worldPos(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -2266,7 +2506,7 @@ return WGA_StructureFuncs_CPU::worldPos(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_StructureFuncs_CPU::worldPos(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "worldPos")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "worldPos"), hasStaticDimensionality));
 					};
 
 					result[80] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2275,6 +2515,9 @@ return WGA_StructureFuncs_CPU::worldPos(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						
 
@@ -2286,7 +2529,7 @@ return WGA_StructureFuncs_CPU::worldPos(api, key, data , argv1);
 						const auto fillFunc = [=] (const WGA_DataRecord_CPU::Key &key, const typename Result::DataHandle &data) {
 							return WGA_StructureFuncs_CPU::localPos(api, key, data );
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "localPos")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "localPos"), hasStaticDimensionality));
 					};
 
 					result[81] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2295,6 +2538,9 @@ return WGA_StructureFuncs_CPU::worldPos(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -2308,7 +2554,7 @@ return WGA_StructureFuncs_CPU::worldPos(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_StructureFuncs_CPU::localPos(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "localPos")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "localPos"), hasStaticDimensionality));
 					};
 
 					result[82] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2317,6 +2563,9 @@ return WGA_StructureFuncs_CPU::localPos(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						
 
@@ -2328,7 +2577,7 @@ return WGA_StructureFuncs_CPU::localPos(api, key, data , argv1);
 						const auto fillFunc = [=] (const WGA_DataRecord_CPU::Key &key, const typename Result::DataHandle &data) {
 							return WGA_StructureFuncs_CPU::localSeed(api, key, data );
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "localSeed")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "localSeed"), hasStaticDimensionality));
 					};
 
 					result[83] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2337,6 +2586,9 @@ return WGA_StructureFuncs_CPU::localPos(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 
@@ -2350,7 +2602,7 @@ return WGA_StructureFuncs_CPU::localPos(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_StructureFuncs_CPU::distanceTo(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "distanceTo")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "distanceTo"), hasStaticDimensionality));
 					};
 
 					result[84] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2359,6 +2611,9 @@ return WGA_StructureFuncs_CPU::distanceTo(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
@@ -2374,7 +2629,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_StructureFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[85] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2383,6 +2638,9 @@ return WGA_StructureFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
@@ -2398,7 +2656,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_StructureFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[86] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2407,6 +2665,9 @@ return WGA_StructureFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
@@ -2422,7 +2683,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_StructureFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[87] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2431,6 +2692,9 @@ return WGA_StructureFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
@@ -2446,7 +2710,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_StructureFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[88] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2455,6 +2719,9 @@ return WGA_StructureFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
@@ -2470,7 +2737,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_StructureFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[89] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2479,6 +2746,9 @@ return WGA_StructureFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
@@ -2494,7 +2764,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_StructureFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[90] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2503,6 +2773,9 @@ return WGA_StructureFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
@@ -2518,7 +2791,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_StructureFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sampleAt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sampleAt"), hasStaticDimensionality));
 					};
 
 					result[91] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2527,6 +2800,9 @@ return WGA_StructureFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -2540,7 +2816,7 @@ return WGA_StructureFuncs_CPU::sampleAt(api, key, data , argv1, argv2);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_NoiseFuncs_CPU::randC(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "randC")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "randC"), hasStaticDimensionality));
 					};
 
 					result[92] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2549,6 +2825,9 @@ return WGA_NoiseFuncs_CPU::randC(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -2562,7 +2841,7 @@ return WGA_NoiseFuncs_CPU::randC(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_StructureFuncs_CPU::randL(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "randL")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "randL"), hasStaticDimensionality));
 					};
 
 					result[93] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2571,6 +2850,9 @@ return WGA_StructureFuncs_CPU::randL(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -2584,7 +2866,7 @@ return WGA_StructureFuncs_CPU::randL(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_NoiseFuncs_CPU::randPC(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "randPC")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "randPC"), hasStaticDimensionality));
 					};
 
 					result[94] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2593,6 +2875,9 @@ return WGA_NoiseFuncs_CPU::randPC(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -2606,7 +2891,7 @@ return WGA_NoiseFuncs_CPU::randPC(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_NoiseFuncs_CPU::rand2D(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "rand2D")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "rand2D"), hasStaticDimensionality));
 					};
 
 					result[95] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2615,6 +2900,9 @@ return WGA_NoiseFuncs_CPU::rand2D(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -2628,7 +2916,7 @@ return WGA_NoiseFuncs_CPU::rand2D(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_NoiseFuncs_CPU::rand3D(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "rand3D")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "rand3D"), hasStaticDimensionality));
 					};
 
 					result[96] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2637,6 +2925,9 @@ return WGA_NoiseFuncs_CPU::rand3D(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -2654,7 +2945,7 @@ Arg2 argv2 = Arg2(args[1]);
 Arg3 argv3 = Arg3(args[2]);
 return WGA_NoiseFuncs_CPU::valueNoisePC(api, key, data , argv1, argv2, argv3);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "valueNoisePC")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "valueNoisePC"), hasStaticDimensionality));
 					};
 
 					result[97] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2663,6 +2954,9 @@ return WGA_NoiseFuncs_CPU::valueNoisePC(api, key, data , argv1, argv2, argv3);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -2680,7 +2974,7 @@ Arg2 argv2 = Arg2(args[1]);
 Arg3 argv3 = Arg3(args[2]);
 return WGA_NoiseFuncs_CPU::valueNoise2D(api, key, data , argv1, argv2, argv3);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "valueNoise2D")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "valueNoise2D"), hasStaticDimensionality));
 					};
 
 					result[98] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2689,6 +2983,9 @@ return WGA_NoiseFuncs_CPU::valueNoise2D(api, key, data , argv1, argv2, argv3);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -2704,7 +3001,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_NoiseFuncs_CPU::perlin2D(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "perlin2D")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "perlin2D"), hasStaticDimensionality));
 					};
 
 					result[99] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2713,6 +3010,9 @@ return WGA_NoiseFuncs_CPU::perlin2D(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -2728,7 +3028,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_NoiseFuncs_CPU::perlin3D(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "perlin3D")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "perlin3D"), hasStaticDimensionality));
 					};
 
 					result[100] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2737,6 +3037,9 @@ return WGA_NoiseFuncs_CPU::perlin3D(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -2756,7 +3059,7 @@ Arg3 argv3 = Arg3(args[2]);
 Arg4 argv4 = Arg4(args[3]);
 return WGA_NoiseFuncs_CPU::voronoi2D(api, key, data , argv1, argv2, argv3, argv4);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "voronoi2D")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "voronoi2D"), hasStaticDimensionality));
 					};
 
 					result[101] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2765,6 +3068,9 @@ return WGA_NoiseFuncs_CPU::voronoi2D(api, key, data , argv1, argv2, argv3, argv4
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -2786,7 +3092,7 @@ Arg4 argv4 = Arg4(args[3]);
 Arg5 argv5 = Arg5(args[4]);
 return WGA_NoiseFuncs_CPU::voronoi2DColored(api, key, data , argv1, argv2, argv3, argv4, argv5);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "voronoi2DColored")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "voronoi2DColored"), hasStaticDimensionality));
 					};
 
 					result[102] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2795,6 +3101,9 @@ return WGA_NoiseFuncs_CPU::voronoi2DColored(api, key, data , argv1, argv2, argv3
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -2810,7 +3119,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_NoiseFuncs_CPU::poissonDisc2DBool(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "poissonDisc2DBool")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "poissonDisc2DBool"), hasStaticDimensionality));
 					};
 
 					result[103] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2819,6 +3128,9 @@ return WGA_NoiseFuncs_CPU::poissonDisc2DBool(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -2834,7 +3146,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_NoiseFuncs_CPU::osimplex2D(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "osimplex2D")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "osimplex2D"), hasStaticDimensionality));
 					};
 
 					result[104] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2843,6 +3155,9 @@ return WGA_NoiseFuncs_CPU::osimplex2D(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -2858,7 +3173,7 @@ using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 Arg2 argv2 = Arg2(args[1]);
 return WGA_NoiseFuncs_CPU::osimplex3D(api, key, data , argv1, argv2);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "osimplex3D")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "osimplex3D"), hasStaticDimensionality));
 					};
 
 					result[105] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2867,6 +3182,9 @@ return WGA_NoiseFuncs_CPU::osimplex3D(api, key, data , argv1, argv2);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -2880,7 +3198,7 @@ return WGA_NoiseFuncs_CPU::osimplex3D(api, key, data , argv1, argv2);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_UtilityFuncs_CPU::minPC(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "minPC")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "minPC"), hasStaticDimensionality));
 					};
 
 					result[106] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2889,6 +3207,9 @@ return WGA_UtilityFuncs_CPU::minPC(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = true || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -2902,7 +3223,7 @@ return WGA_UtilityFuncs_CPU::minPC(api, key, data , argv1);
 							Arg1 argv1 = Arg1(args[0]);
 return WGA_UtilityFuncs_CPU::maxPC(api, key, data , argv1);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "maxPC")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "maxPC"), hasStaticDimensionality));
 					};
 
 					result[107] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2911,6 +3232,9 @@ return WGA_UtilityFuncs_CPU::maxPC(api, key, data , argv1);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -2944,7 +3268,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "min")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "min"), hasStaticDimensionality));
 					};
 
 					result[108] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2953,6 +3277,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -2986,7 +3313,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "min")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "min"), hasStaticDimensionality));
 					};
 
 					result[109] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -2995,6 +3322,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -3028,7 +3358,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "min")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "min"), hasStaticDimensionality));
 					};
 
 					result[110] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3037,6 +3367,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -3070,7 +3403,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "max")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "max"), hasStaticDimensionality));
 					};
 
 					result[111] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3079,6 +3412,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -3112,7 +3448,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "max")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "max"), hasStaticDimensionality));
 					};
 
 					result[112] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3121,6 +3457,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -3154,7 +3493,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "max")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "max"), hasStaticDimensionality));
 					};
 
 					result[113] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3163,6 +3502,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -3180,7 +3522,7 @@ Arg2 argv2 = Arg2(args[1]);
 Arg3 argv3 = Arg3(args[2]);
 return WGA_UtilityFuncs_CPU::smoothMin(api, key, data , argv1, argv2, argv3);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "smoothMin")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "smoothMin"), hasStaticDimensionality));
 					};
 
 					result[114] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3189,6 +3531,9 @@ return WGA_UtilityFuncs_CPU::smoothMin(api, key, data , argv1, argv2, argv3);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -3206,7 +3551,7 @@ Arg2 argv2 = Arg2(args[1]);
 Arg3 argv3 = Arg3(args[2]);
 return WGA_UtilityFuncs_CPU::smoothMax(api, key, data , argv1, argv2, argv3);
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "smoothMax")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "smoothMax"), hasStaticDimensionality));
 					};
 
 					result[115] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3215,6 +3560,9 @@ return WGA_UtilityFuncs_CPU::smoothMax(api, key, data , argv1, argv2, argv3);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -3254,7 +3602,7 @@ const Arg3::T arg3 = argh3[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "clamp")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "clamp"), hasStaticDimensionality));
 					};
 
 					result[116] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3263,6 +3611,9 @@ const Arg3::T arg3 = argh3[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -3302,7 +3653,7 @@ const Arg3::T arg3 = argh3[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "clamp")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "clamp"), hasStaticDimensionality));
 					};
 
 					result[117] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3311,6 +3662,9 @@ const Arg3::T arg3 = argh3[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -3350,7 +3704,7 @@ const Arg3::T arg3 = argh3[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "clamp")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "clamp"), hasStaticDimensionality));
 					};
 
 					result[118] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3359,6 +3713,9 @@ const Arg3::T arg3 = argh3[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -3386,7 +3743,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "clamp01")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "clamp01"), hasStaticDimensionality));
 					};
 
 					result[119] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3395,6 +3752,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -3422,7 +3782,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "clamp01")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "clamp01"), hasStaticDimensionality));
 					};
 
 					result[120] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3431,6 +3791,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -3458,7 +3821,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "clamp01")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "clamp01"), hasStaticDimensionality));
 					};
 
 					result[121] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3467,6 +3830,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -3506,7 +3872,7 @@ const Arg3::T arg3 = argh3[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "mix")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "mix"), hasStaticDimensionality));
 					};
 
 					result[122] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3515,6 +3881,9 @@ const Arg3::T arg3 = argh3[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -3554,7 +3923,7 @@ const Arg3::T arg3 = argh3[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "mix")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "mix"), hasStaticDimensionality));
 					};
 
 					result[123] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3563,6 +3932,9 @@ const Arg3::T arg3 = argh3[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -3602,7 +3974,7 @@ const Arg3::T arg3 = argh3[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "mix")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "mix"), hasStaticDimensionality));
 					};
 
 					result[124] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3611,6 +3983,9 @@ const Arg3::T arg3 = argh3[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -3638,7 +4013,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "abs")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "abs"), hasStaticDimensionality));
 					};
 
 					result[125] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3647,6 +4022,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -3674,7 +4052,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "abs")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "abs"), hasStaticDimensionality));
 					};
 
 					result[126] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3683,6 +4061,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -3710,7 +4091,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "abs")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "abs"), hasStaticDimensionality));
 					};
 
 					result[127] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3719,6 +4100,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -3746,7 +4130,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "floor")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "floor"), hasStaticDimensionality));
 					};
 
 					result[128] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3755,6 +4139,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -3782,7 +4169,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "floor")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "floor"), hasStaticDimensionality));
 					};
 
 					result[129] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3791,6 +4178,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -3818,7 +4208,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "floor")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "floor"), hasStaticDimensionality));
 					};
 
 					result[130] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3827,6 +4217,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -3854,7 +4247,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "ceil")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "ceil"), hasStaticDimensionality));
 					};
 
 					result[131] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3863,6 +4256,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -3890,7 +4286,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "ceil")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "ceil"), hasStaticDimensionality));
 					};
 
 					result[132] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3899,6 +4295,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -3926,7 +4325,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "ceil")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "ceil"), hasStaticDimensionality));
 					};
 
 					result[133] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3935,6 +4334,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -3962,7 +4364,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "round")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "round"), hasStaticDimensionality));
 					};
 
 					result[134] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -3971,6 +4373,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -3998,7 +4403,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "round")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "round"), hasStaticDimensionality));
 					};
 
 					result[135] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4007,6 +4412,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -4034,7 +4442,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "round")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "round"), hasStaticDimensionality));
 					};
 
 					result[136] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4043,6 +4451,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -4070,7 +4481,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "fract")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "fract"), hasStaticDimensionality));
 					};
 
 					result[137] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4079,6 +4490,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -4106,7 +4520,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "fract")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "fract"), hasStaticDimensionality));
 					};
 
 					result[138] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4115,6 +4529,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -4142,7 +4559,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "fract")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "fract"), hasStaticDimensionality));
 					};
 
 					result[139] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4151,6 +4568,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -4178,7 +4598,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "ffract")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "ffract"), hasStaticDimensionality));
 					};
 
 					result[140] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4187,6 +4607,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -4214,7 +4637,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "ffract")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "ffract"), hasStaticDimensionality));
 					};
 
 					result[141] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4223,6 +4646,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -4250,7 +4676,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "ffract")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "ffract"), hasStaticDimensionality));
 					};
 
 					result[142] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4259,6 +4685,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -4292,7 +4721,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "pow")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "pow"), hasStaticDimensionality));
 					};
 
 					result[143] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4301,6 +4730,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -4328,7 +4760,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sin")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sin"), hasStaticDimensionality));
 					};
 
 					result[144] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4337,6 +4769,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -4364,7 +4799,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "cos")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "cos"), hasStaticDimensionality));
 					};
 
 					result[145] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4373,6 +4808,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 
@@ -4400,7 +4838,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "inverse")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "inverse"), hasStaticDimensionality));
 					};
 
 					result[146] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4409,6 +4847,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 
@@ -4436,7 +4877,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "inverse")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "inverse"), hasStaticDimensionality));
 					};
 
 					result[147] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4445,6 +4886,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 
@@ -4472,7 +4916,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "inverse")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "inverse"), hasStaticDimensionality));
 					};
 
 					result[148] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4481,6 +4925,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -4514,7 +4961,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "add")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "add"), hasStaticDimensionality));
 					};
 
 					result[149] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4523,6 +4970,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -4556,7 +5006,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "add")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "add"), hasStaticDimensionality));
 					};
 
 					result[150] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4565,6 +5015,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -4598,7 +5051,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "add")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "add"), hasStaticDimensionality));
 					};
 
 					result[151] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4607,6 +5060,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -4640,7 +5096,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "add")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "add"), hasStaticDimensionality));
 					};
 
 					result[152] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4649,6 +5105,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -4682,7 +5141,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "add")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "add"), hasStaticDimensionality));
 					};
 
 					result[153] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4691,6 +5150,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -4724,7 +5186,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "add")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "add"), hasStaticDimensionality));
 					};
 
 					result[154] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4733,6 +5195,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -4766,7 +5231,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sub")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sub"), hasStaticDimensionality));
 					};
 
 					result[155] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4775,6 +5240,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -4808,7 +5276,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sub")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sub"), hasStaticDimensionality));
 					};
 
 					result[156] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4817,6 +5285,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -4850,7 +5321,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sub")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sub"), hasStaticDimensionality));
 					};
 
 					result[157] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4859,6 +5330,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -4892,7 +5366,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sub")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sub"), hasStaticDimensionality));
 					};
 
 					result[158] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4901,6 +5375,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -4934,7 +5411,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sub")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sub"), hasStaticDimensionality));
 					};
 
 					result[159] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4943,6 +5420,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -4976,7 +5456,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "sub")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "sub"), hasStaticDimensionality));
 					};
 
 					result[160] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -4985,6 +5465,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -5018,7 +5501,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "mult")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "mult"), hasStaticDimensionality));
 					};
 
 					result[161] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5027,6 +5510,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -5060,7 +5546,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "mult")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "mult"), hasStaticDimensionality));
 					};
 
 					result[162] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5069,6 +5555,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -5102,7 +5591,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "mult")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "mult"), hasStaticDimensionality));
 					};
 
 					result[163] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5111,6 +5600,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -5144,7 +5636,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "mult")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "mult"), hasStaticDimensionality));
 					};
 
 					result[164] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5153,6 +5645,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -5186,7 +5681,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "mult")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "mult"), hasStaticDimensionality));
 					};
 
 					result[165] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5195,6 +5690,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -5228,7 +5726,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "mult")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "mult"), hasStaticDimensionality));
 					};
 
 					result[166] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5237,6 +5735,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -5270,7 +5771,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "div")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "div"), hasStaticDimensionality));
 					};
 
 					result[167] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5279,6 +5780,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -5312,7 +5816,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "div")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "div"), hasStaticDimensionality));
 					};
 
 					result[168] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5321,6 +5825,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -5354,7 +5861,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "div")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "div"), hasStaticDimensionality));
 					};
 
 					result[169] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5363,6 +5870,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -5396,7 +5906,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "div")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "div"), hasStaticDimensionality));
 					};
 
 					result[170] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5405,6 +5915,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -5438,7 +5951,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "div")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "div"), hasStaticDimensionality));
 					};
 
 					result[171] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5447,6 +5960,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -5480,7 +5996,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "div")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "div"), hasStaticDimensionality));
 					};
 
 					result[172] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5489,6 +6005,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -5522,7 +6041,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "mod")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "mod"), hasStaticDimensionality));
 					};
 
 					result[173] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5531,6 +6050,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -5564,7 +6086,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "mod")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "mod"), hasStaticDimensionality));
 					};
 
 					result[174] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5573,6 +6095,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -5606,7 +6131,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "mod")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "mod"), hasStaticDimensionality));
 					};
 
 					result[175] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5615,6 +6140,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -5648,7 +6176,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "mod")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "mod"), hasStaticDimensionality));
 					};
 
 					result[176] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5657,6 +6185,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -5690,7 +6221,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "mod")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "mod"), hasStaticDimensionality));
 					};
 
 					result[177] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5699,6 +6230,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -5732,7 +6266,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "mod")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "mod"), hasStaticDimensionality));
 					};
 
 					result[178] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5741,6 +6275,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
@@ -5774,7 +6311,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "logOr")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "logOr"), hasStaticDimensionality));
 					};
 
 					result[179] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5783,6 +6320,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
@@ -5816,7 +6356,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "logAnd")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "logAnd"), hasStaticDimensionality));
 					};
 
 					result[180] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5825,6 +6365,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 
@@ -5852,7 +6395,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "logNot")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "logNot"), hasStaticDimensionality));
 					};
 
 					result[181] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5861,6 +6404,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 
@@ -5888,7 +6434,7 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "bool")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "bool"), hasStaticDimensionality));
 					};
 
 					result[182] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5897,6 +6443,9 @@ argh1 = argv1.dataHandle(key.origin, key.subKey);
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -5930,7 +6479,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compEq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compEq"), hasStaticDimensionality));
 					};
 
 					result[183] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5939,6 +6488,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -5972,7 +6524,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compEq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compEq"), hasStaticDimensionality));
 					};
 
 					result[184] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -5981,6 +6533,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -6014,7 +6569,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compEq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compEq"), hasStaticDimensionality));
 					};
 
 					result[185] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6023,6 +6578,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
@@ -6056,7 +6614,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compEq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compEq"), hasStaticDimensionality));
 					};
 
 					result[186] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6065,6 +6623,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
@@ -6098,7 +6659,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compEq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compEq"), hasStaticDimensionality));
 					};
 
 					result[187] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6107,6 +6668,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
@@ -6140,7 +6704,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compEq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compEq"), hasStaticDimensionality));
 					};
 
 					result[188] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6149,6 +6713,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
@@ -6182,7 +6749,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compEq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compEq"), hasStaticDimensionality));
 					};
 
 					result[189] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6191,6 +6758,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -6224,7 +6794,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compEq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compEq"), hasStaticDimensionality));
 					};
 
 					result[190] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6233,6 +6803,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -6266,7 +6839,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compEq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compEq"), hasStaticDimensionality));
 					};
 
 					result[191] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6275,6 +6848,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -6308,7 +6884,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compNeq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compNeq"), hasStaticDimensionality));
 					};
 
 					result[192] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6317,6 +6893,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
@@ -6350,7 +6929,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compNeq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compNeq"), hasStaticDimensionality));
 					};
 
 					result[193] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6359,6 +6938,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
@@ -6392,7 +6974,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compNeq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compNeq"), hasStaticDimensionality));
 					};
 
 					result[194] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6401,6 +6983,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
@@ -6434,7 +7019,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compNeq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compNeq"), hasStaticDimensionality));
 					};
 
 					result[195] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6443,6 +7028,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>;
@@ -6476,7 +7064,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compNeq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compNeq"), hasStaticDimensionality));
 					};
 
 					result[196] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6485,6 +7073,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Rule>;
@@ -6518,7 +7109,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compNeq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compNeq"), hasStaticDimensionality));
 					};
 
 					result[197] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6527,6 +7118,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::ComponentNode>;
@@ -6560,7 +7154,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compNeq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compNeq"), hasStaticDimensionality));
 					};
 
 					result[198] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6569,6 +7163,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float2>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -6602,7 +7199,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compNeq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compNeq"), hasStaticDimensionality));
 					};
 
 					result[199] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6611,6 +7208,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float3>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -6644,7 +7244,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compNeq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compNeq"), hasStaticDimensionality));
 					};
 
 					result[200] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6653,6 +7253,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -6686,7 +7289,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compLt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compLt"), hasStaticDimensionality));
 					};
 
 					result[201] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6695,6 +7298,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -6728,7 +7334,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compGt")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compGt"), hasStaticDimensionality));
 					};
 
 					result[202] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6737,6 +7343,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -6770,7 +7379,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compLeq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compLeq"), hasStaticDimensionality));
 					};
 
 					result[203] = [] (WorldGenAPI_CPU *api, const WorldGenAPI::FunctionArgs &args) {
@@ -6779,6 +7388,9 @@ const Arg2::T arg2 = argh2[i];
 						// If the function call uses any contextual value, mark tall used arguments as cross sampled to keep them better in the cache
 						if(isContextual) for(WGA_Value *v : args) static_cast<WGA_Value_CPU*>(v)->markAsCrossSampled(0);
 
+						// Dimensionality does not depend on the structure context if it is fixed or if all arguments have static dimensionality (non-contextual values always do)
+						const bool hasStaticDimensionality = false || iterator(args).allx(static_cast<WGA_Value_CPU *>(x)->hasStaticDimensionality());
+
 						using Result = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Bool>;
 						using Arg1 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
 using Arg2 = WGA_ValueWrapper_CPU<WGA_Value::ValueType::Float>;
@@ -6812,7 +7424,7 @@ const Arg2::T arg2 = argh2[i];
 						}
 						return data;
 						};
-						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(dimFunc, fillFunc, "compGeq")));
+						return api->registerSymbol(new WGA_Value_CPU(*api, Result::valueType, isContextual, dimFunc, wga_fillCtor<Result::valueType>(hasStaticDimensionality, dimFunc, fillFunc, "compGeq"), hasStaticDimensionality));
 					};
 
 					
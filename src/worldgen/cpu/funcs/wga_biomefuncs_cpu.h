@@ -55,7 +55,7 @@ void WGA_BiomeFuncs_CPU::biomeParam_nearestSet(Api api, Key key, DH <t> result,
 				if(!dataSet[j])
 					continue;
 
-				const float weight = biomeData.weight[i % chunkSurface][j];
+				const float weight = biomeData.biomeWeights(j)[i % chunkSurface];
 				if(weight > largestWeight) {
 					largestWeight = weight;
 					resultBiome = j;
@@ -72,12 +72,60 @@ void WGA_BiomeFuncs_CPU::biomeParam_weighted(Api api, Key key, DH <t> result, V
 	const auto biomeDataPtr = api->getBiomeData(key.origin);
 	const WGA_BiomeData_CPU &biomeData = biomeDataPtr->data;
 
+	// Only one biome -> nothing to blend
+	if(biomeData.isSingleBiome()) {
+		const DH <t> dataHandle = WGA_ValueWrapper_CPU<t>(biomeData.biomes[0]->param(param.v)).dataHandle(key.origin);
+		for(int i = 0; i < result.size; i++)
+			result[i] = dataHandle[i];
+
+		return;
+	}
+
 	DH <t> dataHandles[WGA_BiomeData_CPU::maxCount];
 	for(int i = 0; i < biomeData.count; i++)
 		dataHandles[i] = WGA_ValueWrapper_CPU<t>(biomeData.biomes[i]->param(param.v)).dataHandle(key.origin);
 
 	const DH <VT::Float> paramHandle = ipolParam.dataHandle(key.origin);
 
+	// Interpolation param does not vary along the Z axis (usually it is constant) -> normalized weights can be calculated once per column
+	if(paramHandle.size <= chunkSurface) {
+		float normWeights[WGA_BiomeData_CPU::maxCount][chunkSurface];
+		float weightsSum[chunkSurface] = {0};
+
+		for(int j = 0; j < biomeData.count; j++) {
+			const float *w = biomeData.biomeWeights(j);
+			float *nw = normWeights[j];
+
+			for(int c = 0; c < chunkSurface; c++) {
+				const float ipol = paramHandle[c];
+				nw[c] = (ipol == 1) ? w[c] : pow(w[c], ipol);
+				weightsSum[c] += nw[c];
+			}
+		}
+
+		for(int c = 0; c < chunkSurface; c++)
+			weightsSum[c] = 1 / weightsSum[c];
+
+		for(int j = 0; j < biomeData.count; j++) {
+			for(int c = 0; c < chunkSurface; c++)
+				normWeights[j][c] *= weightsSum[c];
+		}
+
+		// Blend the params biome by biome (vectorizable)
+		for(int i = 0; i < result.size; i++)
+			result[i] = typename DH<t>::T(0);
+
+		for(int j = 0; j < biomeData.count; j++) {
+			const DH <t> &h = dataHandles[j];
+			const float *nw = normWeights[j];
+
+			for(int i = 0; i < result.size; i++)
+				result[i] += h[i] * nw[i % chunkSurface];
+		}
+
+		return;
+	}
+
 	for(int i = 0; i < result.size; i++) {
 		const float ipolParam = paramHandle[i];
 
@@ -85,7 +133,7 @@ void WGA_BiomeFuncs_CPU::biomeParam_weighted(Api api, Key key, DH <t> result, V
 		float weightsSum = 0;
 
 		for(int j = 0; j < biomeData.count; j++) {
-			const float weightMetric = biomeData.weight[i % chunkSurface][j];
+			const float weightMetric = biomeData.biomeWeights(j)[i % chunkSurface];
 			const float weight = pow(weightMetric, ipolParam);
 			weightsSum += weight;
 			sum += dataHandles[j][i] * weight;
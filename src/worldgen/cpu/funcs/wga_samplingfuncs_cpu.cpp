@@ -4,10 +4,34 @@
 void WGA_SamplingFuncs_CPU::sampleGradient2D(WGA_Funcs_CPU::Api api, WGA_Funcs_CPU::Key key, DH <VT::Float2> result, V <VT::Float> value, V <VT::Float> dist) {
 	value.v->markAsCrossSampled(0);
 
+	const auto disth = dist.dataHandle(key.origin);
+
+	// Constant distance -> gather the neighbourhood into a tile and run the stencil over the rows
+	if(disth.size == 1 && result.size >= chunkSurface) {
+		WGA_CrossStencilTile_CPU<VT::Float> tile;
+		if(tile.gather(value, key.origin, static_cast<BlockWorldPos_T>(disth[0]))) {
+			const int r = tile.radius();
+			const float distf = disth[0];
+			const float coef = 1 / (1 + 2 * distf);
+
+			for(int z = 0; z < static_cast<int>(result.size / chunkSurface); z++) {
+				for(int y = 0; y < chunkSize; y++) {
+					const auto xp = tile.horizontalRow(z, y, r), xm = tile.horizontalRow(z, y, -r);
+					const auto yp = tile.verticalRow(z, y, r), ym = tile.verticalRow(z, y, -r);
+					Vector2F *out = result.data + (z << 8) + (y << 4);
+
+					for(int x = 0; x < chunkSize; x++)
+						out[x] = Vector2F(xp[x] - xm[x], yp[x] - ym[x]) * coef;
+				}
+			}
+
+			return;
+		}
+	}
+
 	// Each sampling point will have its own separate cache
 	auto valXp = value, valXm = value, valYp = value, valYm = value;
 
-	const auto disth = dist.dataHandle(key.origin);
 	for(int i = 0; i < result.size; i++) {
 		const BlockWorldPos worldPos = result.worldPos(key.origin, i);
 
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
+
 #include "wga_funcs_cpu.h"
+#include "../supp/wga_crossstenciltile_cpu.h"
 
 class WGA_SamplingFuncs_CPU : public WGA_Funcs_CPU {
 
@@ -19,34 +22,109 @@ public:
 	template<VT t>
 	static void sampleAvg2D(Api api, Key key, DH <t> result, V <t> value, V <VT::Float> dist);
 
+private:
+	/// Sets result[i] = value at positionFunc(i). Positions are bucketed by source chunk, so that each source record is fetched only once.
+	template<VT t, typename F>
+	static void gather(DH <t> &result, V <t> &value, const F &positionFunc);
+
 };
 
+template<WGA_Funcs_CPU::VT t, typename F>
+void WGA_SamplingFuncs_CPU::gather(DH <t> &result, V <t> &value, const F &positionFunc) {
+	/// More source chunks than this -> the positions are too scattered for the bucketing to help, sample voxel by voxel
+	static constexpr int maxBuckets = 27;
+
+	ASSERT(result.size <= chunkVolume);
+
+	BlockWorldPos positions[chunkVolume];
+	uint8_t buckets[chunkVolume];
+
+	BlockWorldPos bucketOrigins[maxBuckets];
+	int bucketCount = 0;
+	bool isScattered = false;
+
+	// Assign the positions to the source chunk buckets; neighbouring positions usually share the chunk, so check the last one first
+	int lastBucket = 0;
+	for(int i = 0; i < result.size; i++) {
+		const BlockWorldPos pos = positionFunc(i);
+		positions[i] = pos;
+
+		if(isScattered)
+			continue;
+
+		const BlockWorldPos origin = pos & ~(chunkSize - 1);
+		if(!bucketCount || bucketOrigins[lastBucket] != origin) {
+			lastBucket = static_cast<int>(std::find(bucketOrigins, bucketOrigins + bucketCount, origin) - bucketOrigins);
+
+			if(lastBucket == bucketCount) {
+				if(bucketCount == maxBuckets) {
+					isScattered = true;
+					continue;
+				}
+
+				bucketOrigins[bucketCount++] = origin;
+			}
+		}
+
+		buckets[i] = static_cast<uint8_t>(lastBucket);
+	}
+
+	if(isScattered) {
+		for(int i = 0; i < result.size; i++)
+			result[i] = value.sampleAt(positions[i]);
+
+		return;
+	}
+
+	// All positions in a single source chunk (the common case)
+	if(bucketCount == 1) {
+		const auto h = value.dataHandle(bucketOrigins[0]);
+		for(int i = 0; i < result.size; i++)
+			result[i] = h[positions[i]];
+
+		return;
+	}
+
+	// Fetch each source record once
+	typename V<t>::DataHandle handles[maxBuckets];
+	for(int i = 0; i < bucketCount; i++)
+		handles[i] = value.dataHandle(bucketOrigins[i]);
+
+	for(int i = 0; i < result.size; i++)
+		result[i] = handles[buckets[i]][positions[i]];
+}
+
 template<WGA_Funcs_CPU::VT t>
 void WGA_SamplingFuncs_CPU::sampleOffset(Api api, Key key, DH <t> result, V <t> value, V <VT::Float3> offsetv) {
 	value.v->markAsCrossSampled(0);
 
-	auto offseth = offsetv.dataHandle(key.origin);
+	const auto offseth = offsetv.dataHandle(key.origin);
 
-	for(int i = 0; i < result.size; i++)
-		result[i] = value.sampleAt(result.worldPos(key.origin, i) + offseth[i].to<BlockWorldPos_T>());
+	gather(result, value, [&](int i) {
+		return result.worldPos(key.origin, i) + offseth[i].to<BlockWorldPos_T>();
+	});
 }
 
 template<WGA_Funcs_CPU::VT t>
 void WGA_SamplingFuncs_CPU::sampleAt(Api api, Key key, DH <t> result, V <t> value, V <VT::Float3> posv) {
 	value.v->markAsCrossSampled(0);
 
-	DH <VT::Float3> posh = posv.dataHandle(key.origin);
-	for(int i = 0; i < result.size; i++)
-		result[i] = value.sampleAt(posh[i].to<BlockWorldPos_T>());
+	const DH <VT::Float3> posh = posv.dataHandle(key.origin);
+
+	gather(result, value, [&](int i) {
+		return posh[i].to<BlockWorldPos_T>();
+	});
 }
 
 template<WGA_Funcs_CPU::VT t>
 void WGA_SamplingFuncs_CPU::sampleAt(Api api, Key key, DH <t> result, V <t> value, V <VT::Float2> posv) {
 	value.v->markAsCrossSampled(0);
 
-	DH <VT::Float2> posh = posv.dataHandle(key.origin);
-	for(int i = 0; i < result.size; i++)
-		result[i] = value.sampleAt(V3F(posh[i], 0).to<BlockWorldPos_T>());
+	const DH <VT::Float2> posh = posv.dataHandle(key.origin);
+
+	gather(result, value, [&](int i) {
+		return V3F(posh[i], 0).to<BlockWorldPos_T>();
+	});
 }
 
 template<WGA_Funcs_CPU::VT t>
@@ -59,6 +137,28 @@ void WGA_SamplingFuncs_CPU::sampleAvg2D(Api api, Key key, DH <t> result, V <t> v
 	const float coef = 1.0f / 5.0f;
 
 	const auto disth = dist.dataHandle(key.origin);
+
+	// Constant distance -> gather the neighbourhood into a tile and run the stencil over the rows
+	if(disth.size == 1 && result.size >= chunkSurface) {
+		WGA_CrossStencilTile_CPU<t> tile;
+		if(tile.gather(value, key.origin, static_cast<BlockWorldPos_T>(disth[0]))) {
+			const int r = tile.radius();
+
+			for(int z = 0; z < static_cast<int>(result.size / chunkSurface); z++) {
+				for(int y = 0; y < chunkSize; y++) {
+					const auto c = tile.horizontalRow(z, y, 0), xp = tile.horizontalRow(z, y, r), xm = tile.horizontalRow(z, y, -r);
+					const auto yp = tile.verticalRow(z, y, r), ym = tile.verticalRow(z, y, -r);
+					auto out = result.data + (z << 8) + (y << 4);
+
+					for(int x = 0; x < chunkSize; x++)
+						out[x] = (c[x] + xp[x] + xm[x] + yp[x] + ym[x]) * coef;
+				}
+			}
+
+			return;
+		}
+	}
+
 	const auto valh = value.dataHandle(key.origin);
 
 	for(int i = 0; i < result.size; i++) {
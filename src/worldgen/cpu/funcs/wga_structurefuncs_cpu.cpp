@@ -8,7 +8,8 @@
 #include "worldgen/cpu/supp/wga_structuregenerator_cpu.h"
 
 void WGA_StructureFuncs_CPU::spawn2D(Api api, Key key, DH <VT::Block> result, V <VT::Rule> entryRule, V <VT::Float> maxRadius, V <VT::Float> seed, V <VT::Float> spawnZ, V <VT::Bool> spawnCondition) {
-	const auto spawnFunc = [&spawnZ, &spawnCondition, &entryRule](Api api, Key key, SpawnList &spawnList) {
+	// Captured by value, the function can be called from a prefetch job after this function returns
+	const auto spawnFunc = [spawnZ, spawnCondition, entryRule](Api api, Key key, SpawnList &spawnList) mutable {
 		ZoneScopedN("spawn2DSpawnFunc");
 
 		const WGA_DataHandle_CPU<VT::Float> spawnZHandle = spawnZ.dataHandle(key.origin);
@@ -121,7 +122,8 @@ void WGA_StructureFuncs_CPU::_spawn(WGA_Funcs_CPU::Api api, WGA_Funcs_CPU::Key k
 		static_cast<WGA_Value_CPU *>(key.symbol)->markAsCrossSampled(1);
 	}
 
-	const auto ctor = [&api, &seed, &spawnFunc](const WGA_DataRecord_CPU::Key &key) {
+	// Captured by value, the ctor is also used for prefetching (called from a different thread after this function returns)
+	const auto ctor = [api, seed, spawnFunc](const WGA_DataRecord_CPU::Key &key) {
 		ZoneScopedN("genStructure");
 
 		auto rec = std::make_shared<StructureRec>();
@@ -131,21 +133,31 @@ void WGA_StructureFuncs_CPU::_spawn(WGA_Funcs_CPU::Api api, WGA_Funcs_CPU::Key k
 
 		const WorldGenSeed seedV = static_cast<WorldGenSeed>(WGA_ValueWrapper_CPU<VT::Float>(seed).constValue());
 
-		WGA_StructureGenerator_CPU structGen(*api);
-
-		for(const SpawnRec &spawnRec: spawnList) {
+		// Spawns are independent on each other, generate them in parallel (each with its own generator) and merge them in the spawn order
+		std::vector<WGA_StructureOutputData_CPUPtr> outputs(spawnList.size());
+		api->parallelFor(spawnList.size(), [&](size_t i) {
 			ZoneScopedN("processSpawnRec");
 
+			const SpawnRec &spawnRec = spawnList[i];
+			WGA_StructureGenerator_CPU structGen(*api);
 			structGen.setup(spawnRec.entryRule, spawnRec.origin, seedV);
 
 			if(!structGen.process())
+				return;
+
+			outputs[i] = structGen.generateOutput();
+		});
+
+		for(const WGA_StructureOutputData_CPUPtr &output: outputs) {
+			if(!output)
 				continue;
 
-			WGA_StructureOutputData_CPUPtr output = structGen.generateOutput();
 			rec->data.push_back(output);
 			rec->dataSizeV += output->dataSize;
 		}
 
+		rec->buildSubChunkIndex();
+
 		return std::static_pointer_cast<WGA_DataRecord_CPU>(rec);
 	};
 
@@ -173,28 +185,27 @@ void WGA_StructureFuncs_CPU::_spawn(WGA_Funcs_CPU::Api api, WGA_Funcs_CPU::Key k
 			rec = std::static_pointer_cast<StructureRec>(api->getDataRecord(recKey, ctor));
 		}
 
-		for(const WGA_StructureOutputData_CPUPtr &struc: rec->data) {
-			ZoneScopedN("procStructureData");
+		// Neighbouring columns will need the records in the ring just outside of the radius -> prefetch them on idle workers (once per column)
+		if(pos == originChunk && !rec->isNeighbourhoodPrefetched.exchange(true)) {
+			ZoneScopedN("prefetch");
 
-			if(!struc->subChunkRecords.contains(key.origin))
-				continue;
+			const ChunkWorldPos_T prefetchRadius = maxRadiusV + 1;
+			for(const ChunkWorldPos &ringPos: vectorIterator<ChunkWorldPos>(originChunk - prefetchRadius, originChunk + prefetchRadius)) {
+				const ChunkWorldPos d = ringPos - originChunk;
+				if(std::abs(d.x()) != prefetchRadius && std::abs(d.y()) != prefetchRadius)
+					continue;
 
-			const auto schr = struc->subChunkRecords.at(key.origin);
+				api->prefetchDataRecord(WGA_DataRecord_CPU::Key(key.symbol, BlockWorldPos::fromChunkBlockIndex(ringPos, 0, 0), 1), ctor);
+			}
+		}
 
-			if(!schr.flatData.empty()) {
-				ASSERT(schr.associativeData.empty());
+		const auto indexIt = rec->subChunkIndex.find(key.origin);
+		if(indexIt == rec->subChunkIndex.end())
+			continue;
 
-				const auto dt = schr.flatData.data();
-				for(int i = 0; i < chunkVolume; i++) {
-					if(auto v = dt[i]; v != blockID_undefined)
-						result[i] = v;
-				}
-			}
-			else
-				for(const auto &v: schr.associativeData) {
-					ASSERT(v.second != blockID_undefined);
-					result[v.first] = v.second;
-				}
+		for(const StructureRec::SubChunkRef &ref: indexIt->second) {
+			ZoneScopedN("procStructureData");
+			ref.structure->mergeInto(*ref.subChunk, result.data);
 		}
 	}
 }
@@ -3,73 +3,74 @@
 #include "worldgen/cpu/worldgenapi_cpu.h"
 #include "worldgen_cpu_utils.h"
 
-void WGA_BiomeData_CPU::calculateFor(WorldGenAPI_CPU &api, const BlockWorldPos &pos) {
+void WGA_BiomeGridCell_CPU::calculateFor(WorldGenAPI_CPU &api, const Vector2I &gridCellOrigin) {
 	const BlockWorldPos_T gridSize = api.biomeGridSize();
 	const BlockWorldPos_T gridSizeMask = gridSize - 1;
 
-	const Vector2I gridNode(pos.x() & ~gridSizeMask, pos.y() & ~gridSizeMask);
-
-	WGA_Biome *rawBiomes[maxCount];
-	Vector2I nodeRelPositions[maxCount];
-
 	const uint32_t seed = api.seed();
 
 	for(int i = 0; i < maxCount; i++) {
 		const Vector2I relPos = Vector2I(-gridSize * 2) + Vector2I(i % maxCountComp, i / maxCountComp) * gridSize;
-		const Vector2I baseWorldPos = gridNode + relPos;
+		const Vector2I baseWorldPos = gridCellOrigin + relPos;
 
 		const uint32_t bhash = WorldGen_CPU_Utils::hashMulti(seed, baseWorldPos.x(), baseWorldPos.y());
 		const Vector2I baseWorldPosOffset = Vector2I(bhash & gridSizeMask, WorldGen_CPU_Utils::hash(8455123, bhash) & gridSizeMask);
 		const Vector2I worldPos = baseWorldPos + baseWorldPosOffset;
 
-		rawBiomes[i] = &api.getChunkBiome(BlockWorldPos(worldPos.x() & ~blockInChunkPosMask, worldPos.y() & ~blockInChunkPosMask, 0));
+		WGA_Biome *biome = &api.getChunkBiome(BlockWorldPos(worldPos.x() & ~blockInChunkPosMask, worldPos.y() & ~blockInChunkPosMask, 0));
 		nodeRelPositions[i] = relPos + baseWorldPosOffset;
-	}
 
-	int rawBiomeMapping[maxCount];
-	for(int i = 0; i < maxCount; i++) {
-		WGA_Biome *biome = rawBiomes[i];
-		bool found = false;
-
-		for(int j = 0; j < i; j++) {
-			if(biome == biomes[j]) {
-				found = true;
-				rawBiomeMapping[i] = j;
-				break;
-			}
-		}
+		const auto it = std::find(biomes, biomes + count, biome);
+		if(it == biomes + count)
+			biomes[count++] = biome;
 
-		if(!found) {
-			biomes[count] = biome;
-			rawBiomeMapping[i] = count++;
-		}
+		nodeBiomes[i] = static_cast<uint8_t>(it - biomes);
 	}
+}
+
+void WGA_BiomeData_CPU::calculateFor(WorldGenAPI_CPU &api, const BlockWorldPos &pos) {
+	const BlockWorldPos_T gridSize = api.biomeGridSize();
+	const BlockWorldPos_T gridSizeMask = gridSize - 1;
 
-	for(int i = 0; i < chunkSurface; i++) {
-		const Vector2I gridRelPos = (pos.xy() & gridSizeMask) + Vector2I(i % chunkSize, i / chunkSize);
+	const Vector2I gridNode(pos.x() & ~gridSizeMask, pos.y() & ~gridSizeMask);
+	const auto cellPtr = api.getBiomeGridCell(gridNode);
+	const WGA_BiomeGridCell_CPU &cell = cellPtr->data;
 
-		int winningBiome = -1;
-		float largestWeight = std::numeric_limits<float>::lowest();
+	count = cell.count;
+	std::copy(cell.biomes, cell.biomes + count, biomes);
 
-		float weights[maxCount] = {0};
-		for(int j = 0; j < maxCount; j++) {
-			const Vector2I diff = (gridRelPos - nodeRelPositions[j]).abs();
-			const float distance = sqrt(static_cast<float>(diff.dotProduct(diff)));
+	weights.assign(count * chunkSurface, 0.0f);
 
-			const int biomeId = rawBiomeMapping[j];
-			float &weight = weights[biomeId];
-			weight += std::max<float>(0, 1 - distance / (gridSize * 1.42f));
+	const Vector2I chunkRelPos = pos.xy() & gridSizeMask;
+	const float radius = gridSize * 1.42f;
 
-			if(weight > largestWeight) {
-				largestWeight = weight;
-				winningBiome = biomeId;
-			}
-		}
+	// Accumulate node contributions one node at a time over all the columns (the column loop is vectorizable)
+	for(int j = 0; j < WGA_BiomeGridCell_CPU::maxCount; j++) {
+		const Vector2I nodePos = cell.nodeRelPositions[j] - chunkRelPos;
 
-		for(int j = 0; j < 9; j++)
-			weight[i][j] = weights[j];
+		// Skip nodes that are too far to affect any column in the chunk
+		const Vector2I outside = (Vector2I(0) - nodePos).max(nodePos - Vector2I(chunkSize - 1)).max(Vector2I(0));
+		if(static_cast<float>(outside.dotProduct(outside)) >= radius * radius)
+			continue;
 
-		ASSERT(winningBiome != -1);
-		nearestBiomes[i] = static_cast<uint8_t>(winningBiome);
+		float *w = weights.data() + cell.nodeBiomes[j] * chunkSurface;
+		const int nx = nodePos.x(), ny = nodePos.y();
+
+		for(int i = 0; i < chunkSurface; i++) {
+			const int dx = (i % chunkSize) - nx;
+			const int dy = (i / chunkSize) - ny;
+			const float distance = sqrt(static_cast<float>(dx * dx + dy * dy));
+			w[i] += std::max<float>(0, 1 - distance / radius);
+		}
+	}
+
+	// Nearest biome = the one with the largest weight (first one wins on ties)
+	std::fill(std::begin(nearestBiomes), std::end(nearestBiomes), 0);
+	for(int j = 1; j < count; j++) {
+		const float *w = biomeWeights(j);
+		for(int i = 0; i < chunkSurface; i++) {
+			if(w[i] > biomeWeights(nearestBiomes[i])[i])
+				nearestBiomes[i] = static_cast<uint8_t>(j);
+		}
 	}
 }
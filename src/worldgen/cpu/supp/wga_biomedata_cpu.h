@@ -1,21 +1,60 @@
 #pragma once
 
 #include <stdint.h>
+#include <vector>
 
-struct WGA_BiomeData_CPU {
+/// Resolved biome grid nodes around a biome grid cell, shared by all chunks in the cell
+struct WGA_BiomeGridCell_CPU {
 
 public:
 	static constexpr int maxCountComp = 5;
 	static constexpr int maxCount = maxCountComp * maxCountComp;
 
+public:
+	/// Distinct biomes of the nodes
+	WGA_Biome *biomes[maxCount] = {nullptr};
+	int count = 0;
+
+	/// Node -> index to biomes
+	uint8_t nodeBiomes[maxCount] = {0};
+
+	/// Node positions relative to the grid cell origin
+	Vector2I nodeRelPositions[maxCount];
+
+public:
+	/// gridCellOrigin has to be aligned to the biome grid size
+	void calculateFor(WorldGenAPI_CPU &api, const Vector2I &gridCellOrigin);
+
+};
+
+struct WGA_BiomeData_CPU {
+
+public:
+	static constexpr int maxCount = WGA_BiomeGridCell_CPU::maxCount;
+
 public:
 	WGA_Biome *biomes[maxCount] = {nullptr};
 	uint8_t nearestBiomes[chunkSurface] = {0};
-	float weight[chunkSurface][maxCount] = {{0}};
 	int count = 0;
 
+	/// Weights of the present biomes only, structure of arrays - chunkSurface weights for biome 0, then for biome 1, ...
+	std::vector<float> weights;
+
 public:
 	void calculateFor(WorldGenAPI_CPU &api, const BlockWorldPos &pos);
 
+	/// Returns array of chunkSurface weights for the given biome
+	inline const float *biomeWeights(int biome) const {
+		return weights.data() + biome * chunkSurface;
+	}
+
+	inline bool isSingleBiome() const {
+		return count == 1;
+	}
+
+	inline int dataSize() const {
+		return static_cast<int>(sizeof(WGA_BiomeData_CPU) + weights.capacity() * sizeof(float));
+	}
+
 };
 
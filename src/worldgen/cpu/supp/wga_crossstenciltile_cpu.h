@@ -0,0 +1,104 @@
+#pragma once
+
+#include <vector>
+
+#include "wga_valuewrapper_cpu.h"
+
+/// Padded tile of a value for the cross-shaped 2D stencils (center + samples at +-radius on the X and Y axes), used by the sampling functions.
+/// The neighbour chunk records are fetched only once and the samples are gathered into contiguous rows, so the stencil can be computed at array speed.
+template<WGA_Value::ValueType type>
+class WGA_CrossStencilTile_CPU {
+
+public:
+	using T = typename WGA_ValueRec_CPU<type>::T;
+	using DataHandle = WGA_DataHandle_CPU<type>;
+
+	/// The stencil can only reach the direct neighbour chunks
+	static constexpr int maxRadius = chunkSize;
+
+public:
+	/// Gathers the tile for the chunk at origin. Returns false if the radius is not supported (the caller should fall back to per-voxel sampling).
+	bool gather(WGA_ValueWrapper_CPU<type> &value, const BlockWorldPos &origin, int radius) {
+		if(radius < 0 || radius > maxRadius)
+			return false;
+
+		radius_ = radius;
+		rowWidth_ = chunkSize + 2 * radius;
+
+		const DataHandle center = value.dataHandle(origin);
+		layerCount_ = center.size == chunkVolume ? chunkSize : 1;
+
+		horizontalRows_.resize(layerCount_ * chunkSize * rowWidth_);
+		verticalRows_.resize(layerCount_ * rowWidth_ * chunkSize);
+
+		// No neighbours are needed for zero radius
+		DataHandle xm = center, xp = center, ym = center, yp = center;
+		if(radius) {
+			xm = value.dataHandle(origin - BlockWorldPos(chunkSize, 0, 0));
+			xp = value.dataHandle(origin + BlockWorldPos(chunkSize, 0, 0));
+			ym = value.dataHandle(origin - BlockWorldPos(0, chunkSize, 0));
+			yp = value.dataHandle(origin + BlockWorldPos(0, chunkSize, 0));
+		}
+
+		const auto copy = [](T *dst, const DataHandle &src, int srcIndex, int count) {
+			for(int i = 0; i < count; i++)
+				dst[i] = src[srcIndex + i];
+		};
+
+		for(int z = 0; z < layerCount_; z++) {
+			const int zIndex = z << 8;
+
+			// Horizontal rows: [-radius, chunkSize + radius) on the X axis
+			for(int y = 0; y < chunkSize; y++) {
+				T *row = horizontalRows_.data() + (z * chunkSize + y) * rowWidth_;
+				const int rowIndex = zIndex | (y << 4);
+
+				copy(row, xm, rowIndex + chunkSize - radius, radius);
+				copy(row + radius, center, rowIndex, chunkSize);
+				copy(row + radius + chunkSize, xp, rowIndex, radius);
+			}
+
+			// Vertical rows: [-radius, chunkSize + radius) on the Y axis, each row is chunkSize wide
+			T *rows = verticalRows_.data() + z * rowWidth_ * chunkSize;
+			for(int x = 0; x < chunkSize; x++) {
+				const int columnIndex = zIndex | x;
+
+				for(int y = 0; y < radius; y++)
+					rows[y * chunkSize + x] = ym[columnIndex | ((chunkSize - radius + y) << 4)];
+
+				for(int y = 0; y < chunkSize; y++)
+					rows[(radius + y) * chunkSize + x] = center[columnIndex | (y << 4)];
+
+				for(int y = 0; y < radius; y++)
+					rows[(radius + chunkSize + y) * chunkSize + x] = yp[columnIndex | (y << 4)];
+			}
+		}
+
+		return true;
+	}
+
+public:
+	inline int radius() const {
+		return radius_;
+	}
+
+	/// Row of the value for block row y of the layer z, offset by dx on the X axis (dx in [-radius, radius])
+	inline const T *horizontalRow(int z, int y, int dx) const {
+		return horizontalRows_.data() + ((z % layerCount_) * chunkSize + y) * rowWidth_ + radius_ + dx;
+	}
+
+	/// Row of the value for block row y + dy of the layer z (dy in [-radius, radius])
+	inline const T *verticalRow(int z, int y, int dy) const {
+		return verticalRows_.data() + ((z % layerCount_) * rowWidth_ + radius_ + y + dy) * chunkSize;
+	}
+
+private:
+	int radius_ = 0, rowWidth_ = 0, layerCount_ = 1;
+
+	/// [layer][y][-radius .. chunkSize + radius)
+	std::vector<T> horizontalRows_;
+
+	/// [layer][-radius .. chunkSize + radius)[x]
+	std::vector<T> verticalRows_;
+
+};
@@ -16,6 +16,15 @@ const size_t WGA_DataCache_CPU::cacheSizes[+CacheType::_count] = {
 	256_MB, // Local3D,
 };
 
+const char *const WGA_DataCache_CPU::cacheTypeNames[+CacheType::_count] = {
+	"Const",
+	"PerChunk",
+	"NonLocal2D",
+	"Local2D",
+	"NonLocal3D",
+	"Local3D",
+};
+
 WGA_DataCache_CPU::WGA_DataCache_CPU() {
 	for(int i = 0; i < +CacheType::_count; i++) {
 		for(int j = 0; j < cacheDivisions; j++) {
@@ -70,10 +79,13 @@ WGA_DataCache_CPU::DataRecordPtr WGA_DataCache_CPU::get(const WGA_DataRecord_CPU
 
 	// Not in the cache - we must create it and put it there
 	if(!result) {
+		std::chrono::steady_clock::time_point generationStart;
+
 		{
 			//ZoneScopedN("dcGen");
 
 			missCount_[+cacheType]++;
+			generationStart = std::chrono::steady_clock::now();
 			result = ctor(key);
 		}
 
@@ -85,6 +97,10 @@ WGA_DataCache_CPU::DataRecordPtr WGA_DataCache_CPU::get(const WGA_DataRecord_CPU
 				cd.cache.insert(key, result, result->dataSize());
 				cd.generatedKeys.insert(key);
 				cd.wipKeys.erase(key);
+
+				SymbolStats &symbolStats = cd.symbolStats[key.symbol];
+				symbolStats.generationCount++;
+				symbolStats.generationTime += std::chrono::steady_clock::now() - generationStart;
 			}
 
 			// THe mutex doesn't need to be locked anymore here
@@ -114,12 +130,60 @@ WGA_DataCache_CPU::DataRecordPtr WGA_DataCache_CPU::get(const WGA_DataRecord_CPU
 }
 
 void WGA_DataCache_CPU::reportHitRate() {
+	// Tracy requires the plot names to stay valid
+	static const auto plotNames = [] {
+		std::vector<std::string> result;
+		for(const char *name: cacheTypeNames)
+			result.push_back(std::format("dataCacheHitRate[{}]", name));
+
+		return result;
+	}();
+
 	for(int i = 0; i < +CacheType::_count; i++) {
-		const int missCount = missCount_[i], hitCount = hitCount_[i];
+		const size_t missCount = missCount_[i], hitCount = hitCount_[i];
+
+		if(missCount + hitCount > 0)
+			TracyPlot(plotNames[i].c_str(), hitCount / (static_cast<float>(missCount) + hitCount) * 100.0f);
+	}
+}
+
+WGA_DataCache_CPU::Stats WGA_DataCache_CPU::stats(CacheType cacheType) {
+	Stats result{
+		.hitCount = hitCount_[+cacheType],
+		.missCount = missCount_[+cacheType],
+	};
+
+	for(CacheData &cd: cacheData_[+cacheType]) {
+		std::unique_lock _ml(cd.mutex);
+		result.evictionCount += cd.cache.evictionCount();
+		result.recordCount += cd.cache.recordCount();
+		result.usedMemory += cd.cache.usedMemory();
+		result.memoryCapacity += cd.cache.memoryCapacity();
+	}
+
+	return result;
+}
+
+std::vector<std::pair<WGA_Symbol *, WGA_DataCache_CPU::SymbolStats>> WGA_DataCache_CPU::symbolStats() {
+	std::unordered_map<WGA_Symbol *, SymbolStats> merged;
 
-		/*if(missCount + hitCount > 0)
-			TracyPlot(TracyUtils::mapName(QStringLiteral("dataCacheHitRate[%1]").arg(i)), hitCount / (static_cast<float>(missCount) + hitCount) * 100.0f);*/
+	for(auto &cds: cacheData_) {
+		for(CacheData &cd: cds) {
+			std::unique_lock _ml(cd.mutex);
+			for(const auto &[symbol, stats]: cd.symbolStats) {
+				SymbolStats &m = merged[symbol];
+				m.generationCount += stats.generationCount;
+				m.generationTime += stats.generationTime;
+			}
+		}
 	}
+
+	std::vector<std::pair<WGA_Symbol *, SymbolStats>> result(merged.begin(), merged.end());
+	std::sort(result.begin(), result.end(), [](const auto &a, const auto &b) {
+		return a.second.generationTime > b.second.generationTime;
+	});
+
+	return result;
 }
 
 WGA_DataCache_CPU::CacheType WGA_DataCache_CPU::getCacheType(WGA_Symbol *symbol, int subKey) {
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <unordered_set>
+#include <unordered_map>
 #include <mutex>
+#include <chrono>
 
 #include "util/enumutils.h"
 
@@ -23,12 +25,6 @@ public:
 	~WGA_DataCache_CPU();
 
 public:
-	/// Subkey - can be used if you need multiple data records per one symbol (used in structurefuncs)
-	DataRecordPtr get(const Key &key, const Ctor &ctor);
-
-	void reportHitRate();
-
-private:
 	enum class CacheType {
 		Const,
 		PerChunk,
@@ -38,6 +34,33 @@ private:
 		Local3D,
 		_count
 	};
+	static const char *const cacheTypeNames[+CacheType::_count];
+
+	struct Stats {
+		size_t hitCount = 0, missCount = 0;
+		size_t evictionCount = 0;
+		size_t recordCount = 0;
+		size_t usedMemory = 0, memoryCapacity = 0; ///< In bytes
+	};
+
+	struct SymbolStats {
+		size_t generationCount = 0;
+		std::chrono::nanoseconds generationTime{0}; ///< Cumulative, including generating records the symbol depends on
+	};
+
+public:
+	/// Subkey - can be used if you need multiple data records per one symbol (used in structurefuncs)
+	DataRecordPtr get(const Key &key, const Ctor &ctor);
+
+	void reportHitRate();
+
+	/// Counters since the cache creation + current memory usage
+	Stats stats(CacheType cacheType);
+
+	/// Generation statistics of all symbols that had any record generated, sorted by the generation time (descending)
+	std::vector<std::pair<WGA_Symbol *, SymbolStats>> symbolStats();
+
+private:
 	static const size_t cacheSizes[+CacheType::_count];
 	/// The cache is split into multiple separate bins to reduce mutex collisions (each record's bin is determined by the hash)
 	static constexpr int cacheDivisions = 8;
@@ -60,6 +83,9 @@ private:
 
 		/// Condition used for waiting for a record being generated in a different thread
 		std::condition_variable_any wipKeyCondition;
+
+		/// Updated under the mutex when inserting the generated record
+		std::unordered_map<WGA_Symbol *, SymbolStats> symbolStats;
 	};
 	CacheData cacheData_[+CacheType::_count][cacheDivisions];
 
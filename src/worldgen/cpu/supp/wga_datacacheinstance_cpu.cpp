@@ -44,5 +44,6 @@ void WGA_DataCacheInstance_CPU::insert(const WGA_DataCacheInstance_CPU::Key &key
 		};
 		const Record r = hash_.takeIndex(hash_.probabilisticSelect(scoreFunc));
 		usedMemory_ -= r.memorySize;
+		evictionCount_++;
 	}
 }
\ No newline at end of file
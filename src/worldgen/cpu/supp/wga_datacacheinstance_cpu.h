@@ -20,6 +20,19 @@ public:
 		memoryCapacity_ = set;
 	}
 
+	inline size_t usedMemory() const {
+		return usedMemory_;
+	}
+
+	inline size_t recordCount() const {
+		return hash_.size();
+	}
+
+	/// Number of records removed from the cache to make space for new ones
+	inline size_t evictionCount() const {
+		return evictionCount_;
+	}
+
 public:
 	Value get(const Key &key);
 
@@ -29,6 +42,7 @@ private:
 	/// Maximum occupied memory by the records
 	size_t memoryCapacity_ = 1_MB;
 	size_t usedMemory_ = 0;
+	size_t evictionCount_ = 0;
 
 	/// Increases with each read access
 	size_t accessCounter_ = 0;
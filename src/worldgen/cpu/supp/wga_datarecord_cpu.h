@@ -48,7 +48,11 @@ public:
 
 public:
 	virtual int dataSize() const override {
-		return sizeof(WGA_DataRecordT_CPU<T>);
+		// Data can report its size if it has dynamically allocated members
+		if constexpr(requires { data.dataSize(); })
+			return sizeof(WGA_DataRecordT_CPU<T>) - sizeof(T) + data.dataSize();
+		else
+			return sizeof(WGA_DataRecordT_CPU<T>);
 	};
 
 
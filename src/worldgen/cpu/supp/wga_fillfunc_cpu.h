@@ -65,12 +65,25 @@ WGA_DataCache_CPU::DataRecordPtr wga_dimFillCtor(const WGA_DataRecord_CPU::Key &
 }
 
 
+/// If hasStaticDimensionality, the dimensionality is resolved right away and the record constructor is bound directly to the fill function for the given dimensionality
 template<WGA_Value::ValueType t>
-WGA_DataRecord_CPU::Ctor wga_fillCtor(const WGA_Value_CPU::DimensionalityFunc &dimFunc, const WGA_FillFunc<t> &fillFunc, const char *funcName) {
-	static const auto dimFillFs = std::vector<std::function<WGA_DataCache_CPU::DataRecordPtr(const WGA_DataRecord_CPU::Key &, const WGA_FillFunc<t> &)> >{
+WGA_DataRecord_CPU::Ctor wga_fillCtor(bool hasStaticDimensionality, const WGA_Value_CPU::DimensionalityFunc &dimFunc, const WGA_FillFunc<t> &fillFunc, const char *funcName) {
+	using DimFillF = WGA_DataCache_CPU::DataRecordPtr(*)(const WGA_DataRecord_CPU::Key &, const WGA_FillFunc<t> &);
+	static constexpr DimFillF dimFillFs[] = {
 		/* Unknown dimensionality */ &wga_dimFillCtor<t, 0>, &wga_dimFillCtor<t, 0>, &wga_dimFillCtor<t, 1>, &wga_dimFillCtor<t, 2>, &wga_dimFillCtor<t, 3>
 	};
-	ASSERT(dimFillFs.size() == +WGA_Value::Dimensionality::_count);
+	static_assert(std::size(dimFillFs) == +WGA_Value::Dimensionality::_count);
+
+	if(hasStaticDimensionality) {
+		const DimFillF dimFillF = dimFillFs[+dimFunc()];
+
+		return [fillFunc, dimFillF, funcName](const WGA_DataRecord_CPU::Key &key) {
+			// Tracy worldgen profiling
+			ZoneTransientN(tracyZone, funcName, true);
+
+			return dimFillF(key, fillFunc);
+		};
+	}
 
 	return [fillFunc, dimFunc, funcName](const WGA_DataRecord_CPU::Key &key) {
 		// Tracy worldgen profiling
@@ -0,0 +1,118 @@
+#include "wga_structureareaindex_cpu.h"
+
+#include "util/assert.h"
+
+void WGA_StructureAreaIndex_CPU::clear() {
+	areas_.clear();
+	names_.clear();
+}
+
+void WGA_StructureAreaIndex_CPU::add(const Area &area) {
+	const uint32_t ix = static_cast<uint32_t>(areas_.size());
+	areas_.push_back(area);
+
+	if(area.nameID >= names_.size())
+		names_.resize(area.nameID + 1);
+
+	NameRecord &rec = names_[area.nameID];
+	rec.allAreas.push_back(ix);
+
+	const CellRange cr = cellRange(area);
+	if(cr.cellCount() > maxAreaCells) {
+		rec.largeAreas.push_back(ix);
+		return;
+	}
+
+	for(BlockWorldPos_T z = cr.start.z(); z <= cr.end.z(); z++) {
+		for(BlockWorldPos_T y = cr.start.y(); y <= cr.end.y(); y++) {
+			for(BlockWorldPos_T x = cr.start.x(); x <= cr.end.x(); x++)
+				rec.grid[BlockWorldPos(x, y, z)].push_back(ix);
+		}
+	}
+}
+
+void WGA_StructureAreaIndex_CPU::truncate(size_t areaCount) {
+	ASSERT(areaCount <= areas_.size());
+
+	// Index lists are ascending, so we just need to pop the tails of the lists the removed areas were added to
+	const auto popTail = [areaCount](std::vector<uint32_t> &v) {
+		while(!v.empty() && v.back() >= areaCount)
+			v.pop_back();
+	};
+
+	for(size_t i = areas_.size(); i > areaCount; i--) {
+		const Area &area = areas_[i - 1];
+		NameRecord &rec = names_[area.nameID];
+
+		popTail(rec.allAreas);
+
+		const CellRange cr = cellRange(area);
+		if(cr.cellCount() > maxAreaCells) {
+			popTail(rec.largeAreas);
+			continue;
+		}
+
+		for(BlockWorldPos_T z = cr.start.z(); z <= cr.end.z(); z++) {
+			for(BlockWorldPos_T y = cr.start.y(); y <= cr.end.y(); y++) {
+				for(BlockWorldPos_T x = cr.start.x(); x <= cr.end.x(); x++) {
+					auto it = rec.grid.find(BlockWorldPos(x, y, z));
+					ASSERT(it != rec.grid.end());
+
+					popTail(it->second);
+					if(it->second.empty())
+						rec.grid.erase(it);
+				}
+			}
+		}
+	}
+
+	areas_.resize(areaCount);
+}
+
+bool WGA_StructureAreaIndex_CPU::overlaps(const Area &area) const {
+	if(area.nameID >= names_.size())
+		return false;
+
+	const NameRecord &rec = names_[area.nameID];
+
+	const auto check = [&](const std::vector<uint32_t> &v) {
+		for(uint32_t ix: v) {
+			if(overlaps(areas_[ix], area))
+				return true;
+		}
+		return false;
+	};
+
+	const CellRange cr = cellRange(area);
+
+	// Query area is too large -> it's faster to check all the areas
+	if(cr.cellCount() > maxAreaCells)
+		return check(rec.allAreas);
+
+	if(check(rec.largeAreas))
+		return true;
+
+	for(BlockWorldPos_T z = cr.start.z(); z <= cr.end.z(); z++) {
+		for(BlockWorldPos_T y = cr.start.y(); y <= cr.end.y(); y++) {
+			for(BlockWorldPos_T x = cr.start.x(); x <= cr.end.x(); x++) {
+				if(auto it = rec.grid.find(BlockWorldPos(x, y, z)); it != rec.grid.end() && check(it->second))
+					return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+size_t WGA_StructureAreaIndex_CPU::CellRange::cellCount() const {
+	const BlockWorldPos d = end - start + 1;
+	return size_t(d.x()) * size_t(d.y()) * size_t(d.z());
+}
+
+WGA_StructureAreaIndex_CPU::CellRange WGA_StructureAreaIndex_CPU::cellRange(const Area &area) {
+	const auto cell = [](const BlockWorldPos &p) {
+		return BlockWorldPos(p.x() >> cellSizeBits, p.y() >> cellSizeBits, p.z() >> cellSizeBits);
+	};
+
+	return CellRange{cell(area.startPos), cell(area.endPos)};
+}
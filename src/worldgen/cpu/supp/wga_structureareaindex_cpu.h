@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+
+#include "pch.h"
+
+/// Spatial index of structure areas used by WGA_StructureGenerator_CPU for the overlap checks.
+/// Areas are bucketed into a grid hash per area name; supports rolling back to a previous area count (for branch failing).
+class WGA_StructureAreaIndex_CPU {
+
+public:
+	struct Area {
+		int nameID; ///< using areaNameMapping
+		BlockWorldPos startPos, endPos; ///< Both inclusive
+	};
+
+public:
+	inline size_t size() const {
+		return areas_.size();
+	}
+
+	void clear();
+
+	void add(const Area &area);
+
+	/// Removes all areas added after the index had size areaCount
+	void truncate(size_t areaCount);
+
+	/// Returns if the area overlaps with any area in the index with the same nameID
+	bool overlaps(const Area &area) const;
+
+private:
+	static constexpr int cellSizeBits = 4;
+
+	/// Areas covering more cells are not put into the grid, but in the large area lists (and checked linearly)
+	static constexpr size_t maxAreaCells = 64;
+
+	struct CellRange {
+		BlockWorldPos start, end;
+
+		size_t cellCount() const;
+	};
+
+	static CellRange cellRange(const Area &area);
+
+	static inline bool overlaps(const Area &a, const Area &b) {
+		return (a.endPos >= b.startPos).all() && (a.startPos <= b.endPos).all();
+	}
+
+private:
+	struct NameRecord {
+		/// Cell pos -> indexes of the areas (ascending)
+		std::unordered_map<BlockWorldPos, std::vector<uint32_t>> grid;
+
+		/// Indexes of the areas that were too large to be put in the grid (ascending)
+		std::vector<uint32_t> largeAreas;
+
+		/// Indexes of all areas with the name (ascending), used when the query area is too large
+		std::vector<uint32_t> allAreas;
+	};
+
+private:
+	std::vector<Area> areas_;
+
+	/// Indexed by nameID
+	std::vector<NameRecord> names_;
+
+};
@@ -18,6 +18,8 @@
 #include "util/containerutils.h"
 
 WGA_StructureGenerator_CPU::WGA_StructureGenerator_CPU(WorldGenAPI_CPU &api) :
+	arena_(64 * 1024),
+	arenaPool_(&arena_),
 	api_(api) {
 
 }
@@ -27,16 +29,11 @@ void WGA_StructureGenerator_CPU::setup(WGA_Rule *entryRule, const BlockWorldPos
 	bind();
 	SCOPE_EXIT(unbind());
 
-	areas_.clear();
-	componentExpansions_ = {};
-	ruleExpansions_ = {};
-	stateStack_ = {};
+	clearState();
 
 	seed_ = WorldGen_CPU_Utils::hash(origin.to<uint32_t>(), seed);
 	origin_ = origin;
 	expansionCount_ = 0;
-	queuedRuleExpansions_ = {};
-	currentDataContext_ = {};
 
 	expandRule(entryRule, origin, BlockOrientation(), nullptr);
 }
@@ -50,8 +47,7 @@ bool WGA_StructureGenerator_CPU::process() {
 		return false;
 
 	addBranch();
-	ruleExpansions_.push_back(queuedRuleExpansions_.front());
-	queuedRuleExpansions_.pop_front();
+	ruleExpansions_.push_back(popQueuedRuleExpansion());
 
 	while(true) {
 		if(ruleExpansions_.empty()) {
@@ -93,8 +89,7 @@ bool WGA_StructureGenerator_CPU::process() {
 			return true;
 
 		// Expansion succeded -> put another expansion to process
-		ruleExpansions_.push_back(queuedRuleExpansions_.front());
-		queuedRuleExpansions_.pop_front();
+		ruleExpansions_.push_back(popQueuedRuleExpansion());
 
 		/*TracyPlot("structureGenerator.stackSize", static_cast<float>(stateStack_.size()));
 		TracyPlot("structureGenerator.componentExpansions", static_cast<float>(componentExpansions_.size()));
@@ -139,17 +134,49 @@ WGA_StructureOutputData_CPUPtr WGA_StructureGenerator_CPU::generateOutput() {
 					const auto volv = (end - start + 1);
 					const BlockWorldPos_T volume = volv.x() * volv.y() * volv.z();
 
-					// Flat data filling
+					// Flat data filling - process whole rows (or planes) at once
 					if(srr.shouldUseFlat(volume)) {
-						auto resh = srr.flatData.data();
-
-						for(const BlockWorldPos &pos: vectorIterator(start, end)) {
-							const int i = pos.x() | (pos.y() << 4) | (pos.z() << 8);
-							ASSERT(i < srr.flatData.size());
-
-							const BlockID blockv = blockh[i];
-							if(blockv != blockID_undefined)
-								resh[i] = blockv;
+						BlockID *resh = srr.flatData.data();
+
+						const bool isConst = blockh.size == 1;
+						const bool isFullX = start.x() == 0 && end.x() == chunkSize - 1;
+						const bool isFullY = start.y() == 0 && end.y() == chunkSize - 1;
+
+						// Calls f(startIndex, length) for contiguous spans of the area. Spans over multiple z planes only when the source data is not 2D (it would overflow the source data)
+						const auto forEachSpan = [&](const auto &f) {
+							if(isFullX && isFullY && blockh.flag != (chunkSurface - 1))
+								f(start.z() << 8, (end.z() - start.z() + 1) * chunkSurface);
+
+							else if(isFullX) {
+								for(BlockWorldPos_T z = start.z(); z <= end.z(); z++)
+									f((start.y() << 4) | (z << 8), (end.y() - start.y() + 1) * chunkSize);
+							}
+
+							else {
+								for(BlockWorldPos_T z = start.z(); z <= end.z(); z++) {
+									for(BlockWorldPos_T y = start.y(); y <= end.y(); y++)
+										f(start.x() | (y << 4) | (z << 8), end.x() - start.x() + 1);
+								}
+							}
+						};
+
+						if(isConst) {
+							const BlockID block = blockh[0];
+							if(block != blockID_undefined)
+								forEachSpan([&](int i, int len) { std::fill_n(resh + i, len, block); });
+						}
+						else {
+							// Branchless blend - keep the previous value where the block is undefined
+							forEachSpan([&](int i, int len) {
+								ASSERT(i + len <= srr.flatData.size());
+
+								const BlockID *src = blockh.data + (i & blockh.flag);
+								BlockID *dst = resh + i;
+								for(int j = 0; j < len; j++) {
+									const BlockID b = src[j];
+									dst[j] = (b != blockID_undefined) ? b : dst[j];
+								}
+							});
 						}
 					}
 						// Associative data filling
@@ -190,11 +217,14 @@ WGA_StructureOutputData_CPUPtr WGA_StructureGenerator_CPU::generateOutput() {
 						srr.associativeData.emplace_back(six, block);
 				}
 			}
-
-			result->dataSize = iterator(result->subChunkRecords).mapx(sizeof(WGA_StructureOutputData_CPU::SubChunkRecord) + (x.second.flatData.empty() ? 0 : sizeof(BlockID) * chunkVolume) + x.second.associativeData.size() * 4).sum();
 		}
 	}
 
+	result->finalize();
+
+	// The output is independent on the generation states, we can release them
+	clearState();
+
 	return result;
 }
 
@@ -232,7 +262,7 @@ void WGA_StructureGenerator_CPU::unbind() {
 bool WGA_StructureGenerator_CPU::expandRule(WGA_Rule *rule, const BlockWorldPos &localOrigin, const BlockOrientation &orientation, const DataContextPtr &data) {
 	// ZoneScoped;
 
-	RuleExpansionContextPtr rex(new RuleExpansionContext{
+	RuleExpansionContextPtr rex = arenaShared(RuleExpansionContext{
 		.rule = rule,
 		.orientation = orientation,
 		.ruleData = DataContext::create(&api_, data, rule, BlockTransformMatrix::translation(localOrigin)),
@@ -301,10 +331,7 @@ bool WGA_StructureGenerator_CPU::expandRule(WGA_Rule *rule, const BlockWorldPos
 	}
 
 	// Insert the rule expansion after currently expanded rule, but it must still be after the last state rules list end so that if we potentially fail the branch and revert to the state, the rule expansion list doesn't get screwed up
-	if(doDepthFirst)
-		queuedRuleExpansions_.push_front(res);
-	else
-		queuedRuleExpansions_.push_back(res);
+	queueRuleExpansion(res, doDepthFirst);
 
 	return true;
 }
@@ -341,7 +368,7 @@ bool WGA_StructureGenerator_CPU::processExpansion(WGA_StructureGenerator_CPU::Ru
 		const auto &opt = ss.possibleOptions[res.optionIndex];
 		WGA_ComponentNode *node = opt.node;
 
-		ComponentExpansionStatePtr cex(new ComponentExpansionState{
+		ComponentExpansionStatePtr cex = arenaShared(ComponentExpansionState{
 			.component = comp,
 			.entryNode = node,
 			.data = DataContext::create(&api_, ss.expansionData, comp),
@@ -405,13 +432,7 @@ bool WGA_StructureGenerator_CPU::processExpansion(WGA_StructureGenerator_CPU::Ru
 
 			// Check if the area is not overlapping other areas with the same name
 			if(!arc.canOverlap || arc.mustOverlap) {
-				const bool overlaps =
-					iterator(areas_)
-						.filterx(area.nameID == x.nameID)
-						.mapx((x.endPos >= area.startPos).all() && (x.startPos <= area.endPos).all())
-						.any();
-
-				if(overlaps != arc.mustOverlap) {
+				if(areas_.overlaps(area) != arc.mustOverlap) {
 					failBranch(comp->description() + " area " + arc.name);
 					return false;
 				}
@@ -419,7 +440,7 @@ bool WGA_StructureGenerator_CPU::processExpansion(WGA_StructureGenerator_CPU::Ru
 
 			// Overlap areas are just for checking
 			if(!arc.isVirtual)
-				areas_.push_back(area);
+				areas_.add(area);
 		}
 
 		// Process param sets
@@ -486,7 +507,7 @@ WGA_StructureGenerator_CPU::RuleExpansionStatePtr WGA_StructureGenerator_CPU::ne
 		const TT tt = rex->targetType();
 
 		if(!superState) {
-			superState = RuleExpansionSuperStatePtr(new RuleExpansionSuperState{
+			superState = arenaShared(RuleExpansionSuperState{
 				.context = ctx,
 				.expansionIndex = expansionIndex,
 				.expansionData = DataContext::create(&api_, ctx->ruleData, rex),
@@ -533,7 +554,7 @@ WGA_StructureGenerator_CPU::RuleExpansionStatePtr WGA_StructureGenerator_CPU::ne
 				superState->possibleOptions.push_back(RuleExpansionSuperState::Option{});
 		}
 
-		return RuleExpansionStatePtr(new RuleExpansionState{
+		return arenaShared(RuleExpansionState{
 			.superState = superState,
 			.optionIndex = optionIndex,
 		});
@@ -547,7 +568,7 @@ void WGA_StructureGenerator_CPU::addBranch() {
 		.areaCount = areas_.size(),
 		.componentExpansionCount = componentExpansions_.size(),
 		.ruleExpansionCount = ruleExpansions_.size(),
-		.queuedRuleExpansions = queuedRuleExpansions_,
+		.queueUndoLogSize = queueUndoLog_.size(),
 	});
 }
 
@@ -561,7 +582,7 @@ void WGA_StructureGenerator_CPU::failBranch(const std::string &reason) {
 
 	// Remove areas and component expansions added after the addBranch() was called
 	ASSERT(s.areaCount <= areas_.size());
-	areas_.resize(s.areaCount);
+	areas_.truncate(s.areaCount);
 
 	ASSERT(s.componentExpansionCount <= componentExpansions_.size());
 	componentExpansions_.resize(s.componentExpansionCount);
@@ -569,16 +590,77 @@ void WGA_StructureGenerator_CPU::failBranch(const std::string &reason) {
 	ASSERT(s.ruleExpansionCount <= ruleExpansions_.size());
 	ruleExpansions_.resize(s.ruleExpansionCount);
 
-	queuedRuleExpansions_ = s.queuedRuleExpansions;
+	ASSERT(s.queueUndoLogSize <= queueUndoLog_.size());
+	while(queueUndoLog_.size() > s.queueUndoLogSize) {
+		QueueUndoRecord &r = queueUndoLog_.back();
+		switch(r.op) {
+
+			case QueueUndoRecord::Op::PushFront:
+				queuedRuleExpansions_.pop_front();
+				break;
+
+			case QueueUndoRecord::Op::PushBack:
+				queuedRuleExpansions_.pop_back();
+				break;
+
+			case QueueUndoRecord::Op::PopFront:
+				queuedRuleExpansions_.push_front(std::move(r.value));
+				break;
+
+		}
+		queueUndoLog_.pop_back();
+	}
 
 	if(!reason.empty())
 		expansionFailureReasons_[reason]++;
 }
 
+void WGA_StructureGenerator_CPU::queueRuleExpansion(const RuleExpansionStatePtr &res, bool front) {
+	if(front)
+		queuedRuleExpansions_.push_front(res);
+	else
+		queuedRuleExpansions_.push_back(res);
+
+	// No branch -> nothing to revert to, no need to record
+	if(!stateStack_.empty())
+		queueUndoLog_.push_back(QueueUndoRecord{front ? QueueUndoRecord::Op::PushFront : QueueUndoRecord::Op::PushBack});
+}
+
+WGA_StructureGenerator_CPU::RuleExpansionStatePtr WGA_StructureGenerator_CPU::popQueuedRuleExpansion() {
+	ASSERT(!queuedRuleExpansions_.empty());
+
+	RuleExpansionStatePtr res = std::move(queuedRuleExpansions_.front());
+	queuedRuleExpansions_.pop_front();
+
+	if(!stateStack_.empty())
+		queueUndoLog_.push_back(QueueUndoRecord{QueueUndoRecord::Op::PopFront, res});
+
+	return res;
+}
+
+void WGA_StructureGenerator_CPU::clearState() {
+	areas_.clear();
+	componentExpansions_ = {};
+	ruleExpansions_ = {};
+	stateStack_ = {};
+	queuedRuleExpansions_ = {};
+	queueUndoLog_ = {};
+	currentDataContext_ = {};
+
+	// All the states referencing the arena memory are released now
+	arenaPool_.release();
+	arena_.release();
+}
+
 bool WGA_StructureGenerator_CPU::checkConditions(WGA_GrammarSymbol *sym) {
 	// ZoneScoped;
 
-	const bool result = iterator(sym->conditions()).mapx(boolValue(x.value, currentDataContext_->constSamplePos())).all();
+	// Position and context independent conditions are evaluated only once per symbol
+	const WGA_GrammarSymbol::CompiledConditions &cc = sym->compiledConditions([this](WGA_Value *val) { return boolValue(val, currentDataContext_->constSamplePos()); });
+	if(!cc.staticResult)
+		return false;
+
+	const bool result = iterator(cc.dynamicConditions).mapx(boolValue(x.value, currentDataContext_->constSamplePos())).all();
 
 	return result;
 }
@@ -610,13 +692,31 @@ BlockID WGA_StructureGenerator_CPU::blockValue(WGA_Value *val, const BlockWorldP
 	return WGA_ValueWrapper_CPU<WGA_Value::ValueType::Block>(val).sampleAt(samplePoint);
 }
 
+WGA_StructureGenerator_CPU::DataContext::DataContext(std::pmr::memory_resource *mem) :
+	alloc_(mem),
+	dataCache_(mem),
+	dimensionalityCache_(mem),
+	paramInputs_(mem),
+	paramOutputs_(mem),
+	paramKeyMapping_(mem),
+	temporarySymbols_(mem),
+	inputParamDimensionalityCache_(mem) {
+
+}
+
 WGA_StructureGenerator_CPU::DataContext::~DataContext() {
 	for(const auto e: temporarySymbols_)
-		delete e;
+		alloc_.delete_object(e);
 }
 
 WGA_StructureGenerator_CPU::DataContextPtr WGA_StructureGenerator_CPU::DataContext::create(WorldGenAPI_CPU *api, const WGA_StructureGenerator_CPU::DataContextPtr &parentContext, WGA_GrammarSymbol *sym, const BlockTransformMatrix &transform) {
-	DataContextPtr r(new DataContext());
+	ASSERT(api->structureGen);
+	std::pmr::polymorphic_allocator<> alloc(&api->structureGen->arenaPool_);
+
+	// Constructor is private, so we can't use allocate_shared
+	DataContext *ptr = new(alloc.allocate_object<DataContext>()) DataContext(alloc.resource());
+	DataContextPtr r(ptr, [alloc](DataContext *p) mutable { alloc.delete_object(p); }, alloc);
+
 	r->load(api, parentContext, sym, transform);
 	return r;
 }
@@ -638,15 +738,15 @@ void WGA_StructureGenerator_CPU::DataContext::load(WorldGenAPI_CPU *api, const D
 
 	updateMatrix();
 
+	paramKeyMapping_.reserve(sym->paramDeclares().size());
 	for(const WGA_GrammarSymbol::ParamDeclare &pd: sym->paramDeclares()) {
-		const std::string key = paramKey(pd.paramName, pd.type);
-		paramInputs_[key] = pd.defaultValue;
-		paramKeyMapping_[pd.value] = key;
+		setParam(paramInputs_, pd.paramID, pd.defaultValue);
+		paramKeyMapping_.emplace_back(pd.value, pd.paramID);
 	}
 
 	if(parentContext) {
-		for(auto it = parentContext->paramOutputs_.begin(), end = parentContext->paramOutputs_.end(); it != end; it++) {
-			WGA_Value_CPU *sourceVal = static_cast<WGA_Value_CPU *>(it->second);
+		for(const auto &[paramID, paramValue]: parentContext->paramOutputs_) {
+			WGA_Value_CPU *sourceVal = static_cast<WGA_Value_CPU *>(paramValue);
 
 			const auto dimFunc = [sourceVal, this] {
 				auto &cdc = WorldGenAPI_CPU::structureGen->currentDataContext_;
@@ -667,15 +767,17 @@ void WGA_StructureGenerator_CPU::DataContext::load(WorldGenAPI_CPU *api, const D
 				return parentContext_->getDataRecord(adjKey, sourceVal->ctor());
 			};
 
-			WGA_Value_CPU *localVal = new WGA_Value_CPU(sourceVal->api(), sourceVal->valueType(), true, dimFunc, ctorFunc);
+			// If the source dimensionality does not depend on the context, we don't need to resolve it through the parent context
+			WGA_Value_CPU *localVal = sourceVal->hasStaticDimensionality()
+			                          ? alloc_.new_object<WGA_Value_CPU>(sourceVal->api(), sourceVal->valueType(), true, [sourceVal] { return sourceVal->dimensionality(); }, ctorFunc, true)
+			                          : alloc_.new_object<WGA_Value_CPU>(sourceVal->api(), sourceVal->valueType(), true, dimFunc, ctorFunc);
 			temporarySymbols_.push_back(localVal);
-			paramInputs_[it->first] = localVal;
+			setParam(paramInputs_, paramID, localVal);
 		}
 	}
 
 	for(const WGA_GrammarSymbol::ParamDeclare &pd: sym->paramDeclares()) {
-		const std::string key = paramKey(pd.paramName, pd.type);
-		if(!paramInputs_[key])
+		if(!param(paramInputs_, pd.paramID))
 			throw std::exception(std::format("Param value not defined for param {}", pd.paramName).c_str());
 	}
 
@@ -684,7 +786,7 @@ void WGA_StructureGenerator_CPU::DataContext::load(WorldGenAPI_CPU *api, const D
 
 void WGA_StructureGenerator_CPU::DataContext::setParams() {
 	for(const WGA_GrammarSymbol::ParamSet &ps: sym_->paramSets())
-		paramOutputs_[paramKey(ps.paramName, ps.value->valueType())] = ps.value;
+		setParam(paramOutputs_, ps.paramID, ps.value);
 }
 
 void WGA_StructureGenerator_CPU::DataContext::updateMatrix() {
@@ -700,8 +802,8 @@ WGA_DataRecord_CPU::Ptr WGA_StructureGenerator_CPU::DataContext::getDataRecord(c
 
 	// Check if the symbol is param declare value, map it to actual param value
 	;
-	if(const auto f = paramKeyMapping_.find(key.symbol); f != paramKeyMapping_.end())
-		result = static_cast<WGA_Value_CPU *>(paramInputs_[f->second])->getDataRecord(key.origin, key.subKey);
+	if(const ParamID id = mappedParamID(key.symbol); id != -1)
+		result = static_cast<WGA_Value_CPU *>(param(paramInputs_, id))->getDataRecord(key.origin, key.subKey);
 	else
 		result = ctor(key);
 
@@ -720,13 +822,32 @@ WGA_Value::Dimensionality WGA_StructureGenerator_CPU::DataContext::getValueDimen
 WGA_Value::Dimensionality WGA_StructureGenerator_CPU::DataContext::getInputParamDimensionality(WGA_Symbol *symbol) {
 	WGA_Value::Dimensionality &result = inputParamDimensionalityCache_[symbol];
 	if(result == WGA_Value::Dimensionality::Unknown) {
-		ASSERT(paramKeyMapping_.contains(symbol));
-		result = paramInputs_[paramKeyMapping_.at(symbol)]->dimensionality();
+		const ParamID id = mappedParamID(symbol);
+		ASSERT(id != -1);
+		result = param(paramInputs_, id)->dimensionality();
 	}
 
 	return result;
 }
 
-std::string WGA_StructureGenerator_CPU::DataContext::paramKey(const std::string &paramName, WGA_Value::ValueType type) {
-	return std::format("{}#{}", paramName, WGA_Value::typeNames.at(type));
+WGA_Value *WGA_StructureGenerator_CPU::DataContext::param(const ParamList &list, ParamID id) {
+	const auto it = std::lower_bound(list.begin(), list.end(), id, [](const auto &p, ParamID id) { return p.first < id; });
+	return (it != list.end() && it->first == id) ? it->second : nullptr;
+}
+
+void WGA_StructureGenerator_CPU::DataContext::setParam(ParamList &list, ParamID id, WGA_Value *value) {
+	const auto it = std::lower_bound(list.begin(), list.end(), id, [](const auto &p, ParamID id) { return p.first < id; });
+	if(it != list.end() && it->first == id)
+		it->second = value;
+	else
+		list.emplace(it, id, value);
+}
+
+WGA_StructureGenerator_CPU::DataContext::ParamID WGA_StructureGenerator_CPU::DataContext::mappedParamID(const WGA_Symbol *symbol) const {
+	for(const auto &[sym, id]: paramKeyMapping_) {
+		if(sym == symbol)
+			return id;
+	}
+
+	return -1;
 }
@@ -2,8 +2,9 @@
 
 #include <vector>
 #include <stack>
-#include <list>
+#include <deque>
 #include <fstream>
+#include <memory_resource>
 
 #include "util/matrix.h"
 #include "util/blockorientation.h"
@@ -12,6 +13,7 @@
 
 #include "wga_datacache_cpu.h"
 #include "wga_structureoutputdata_cpu.h"
+#include "wga_structureareaindex_cpu.h"
 #include "../worldgenapi_cpu.h"
 
 class WGA_StructureGenerator_CPU {
@@ -19,10 +21,7 @@ class WGA_StructureGenerator_CPU {
 public:
 	using Seed = uint32_t;
 
-	struct Area {
-		int nameID; ///< using areaNameMapping
-		BlockWorldPos startPos, endPos;
-	};
+	using Area = WGA_StructureAreaIndex_CPU::Area;
 
 	struct DataContext;
 	using DataContextPtr = std::shared_ptr<DataContext>;
@@ -74,12 +73,22 @@ public:
 		WGA_Value::Dimensionality getInputParamDimensionality(WGA_Symbol *symbol);
 
 	private:
-		DataContext() = default;
+		DataContext(std::pmr::memory_resource *mem);
 
 		void load(WorldGenAPI_CPU *api, const DataContextPtr &parentContext, WGA_GrammarSymbol *sym, const BlockTransformMatrix &transform);
 
 	private:
-		static std::string paramKey(const std::string &paramName, WGA_Value::ValueType type);
+		using ParamID = WGA_GrammarSymbol::ParamID;
+		using ParamList = std::pmr::vector<std::pair<ParamID, WGA_Value *>>;
+
+		/// Returns the param value from the list (sorted by ParamID), nullptr if not present
+		static WGA_Value *param(const ParamList &list, ParamID id);
+
+		/// Inserts or overwrites the param value in the list (sorted by ParamID)
+		static void setParam(ParamList &list, ParamID id, WGA_Value *value);
+
+		/// Returns the param id the value is mapped to, if it is a param declare value of the symbol; -1 otherwise
+		ParamID mappedParamID(const WGA_Symbol *symbol) const;
 
 	private:
 		WorldGenAPI_CPU *api_ = nullptr;
@@ -90,19 +99,22 @@ public:
 		BlockWorldPos constSamplePos_;
 
 	private:
-		std::unordered_map<WGA_DataRecord_CPU::Key, WGA_DataRecord_CPU::Ptr> dataCache_;
-		std::unordered_map<const WGA_Value *, WGA_Value::Dimensionality> dimensionalityCache_;
+		/// All containers are allocated in the structure generator arena
+		std::pmr::polymorphic_allocator<> alloc_;
 
-		/// List of all passed param inputs and outputs
-		std::unordered_map<std::string, WGA_Value *> paramInputs_, paramOutputs_;
+		std::pmr::unordered_map<WGA_DataRecord_CPU::Key, WGA_DataRecord_CPU::Ptr> dataCache_;
+		std::pmr::unordered_map<const WGA_Value *, WGA_Value::Dimensionality> dimensionalityCache_;
 
-		/// Maps param utility as defined in the WGA_GrammarSymbol paramDeclares to param keys
-		std::unordered_map<WGA_Symbol *, std::string> paramKeyMapping_;
+		/// List of all passed param inputs and outputs, sorted by the param id
+		ParamList paramInputs_, paramOutputs_;
+
+		/// Maps param utility as defined in the WGA_GrammarSymbol paramDeclares to param ids (there's usually just a few, so a flat list is fine)
+		std::pmr::vector<std::pair<const WGA_Symbol *, ParamID>> paramKeyMapping_;
 
 		/// Temporary symbols, are deleted with the context
-		std::vector<WGA_Symbol *> temporarySymbols_;
+		std::pmr::vector<WGA_Value_CPU *> temporarySymbols_;
 
-		std::unordered_map<WGA_Symbol *, WGA_Value::Dimensionality> inputParamDimensionalityCache_;
+		std::pmr::unordered_map<WGA_Symbol *, WGA_Value::Dimensionality> inputParamDimensionalityCache_;
 
 		Seed seed_ = 0;
 
@@ -158,7 +170,7 @@ public:
 
 	};
 	using RuleExpansionStatePtr = std::shared_ptr<RuleExpansionState>;
-	using RuleExpansionQueue = std::list<RuleExpansionStatePtr>;
+	using RuleExpansionQueue = std::deque<RuleExpansionStatePtr>;
 
 	struct ComponentExpansionState {
 
@@ -173,11 +185,21 @@ public:
 	using ComponentExpansionStatePtr = std::shared_ptr<ComponentExpansionState>;
 
 	struct State {
-		const size_t areaCount, componentExpansionCount, ruleExpansionCount;
+		// The rule expansion queue is restored by undoing the operations recorded in the queue undo log, so we can safely work with both depth first and breath first expansion (just shrinking the expansion list wouldn't work on depth first expansion)
+		const size_t areaCount, componentExpansionCount, ruleExpansionCount, queueUndoLogSize;
+
+	};
 
-		// We straight up copy the rule expansion list to the state so we can safely work with both depth first and breath first expansion (just shrinking the expansion list wouldn't work on depth first expansion)
-		const RuleExpansionQueue queuedRuleExpansions;
+	/// Operation done on queuedRuleExpansions_, recorded so that it can be undone on failBranch
+	struct QueueUndoRecord {
+		enum class Op : uint8_t {
+			PushFront,
+			PushBack,
+			PopFront
+		};
 
+		Op op;
+		RuleExpansionStatePtr value; ///< Only for PopFront
 	};
 
 public:
@@ -219,6 +241,19 @@ private:
 	void addBranch();
 	void failBranch(const std::string &reason);
 
+	/// Clears all the generation states and releases the arena
+	void clearState();
+
+	/// Allocates the object in the generation arena
+	template<typename T>
+	inline std::shared_ptr<T> arenaShared(T &&v) {
+		return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(&arenaPool_), std::move(v));
+	}
+
+private:
+	void queueRuleExpansion(const RuleExpansionStatePtr &res, bool front);
+	RuleExpansionStatePtr popQueuedRuleExpansion();
+
 	bool checkConditions(WGA_GrammarSymbol *sym);
 
 	void reportStats();
@@ -228,12 +263,19 @@ private:
 	static bool boolValue(WGA_Value *val, const BlockWorldPos &samplePoint);
 	static BlockID blockValue(WGA_Value *val, const BlockWorldPos &samplePoint);
 
+private:
+	/// Memory for the data contexts and expansion states of a single structure generation, released in bulk by clearState().
+	/// Must be declared before all the members that hold the states.
+	std::pmr::monotonic_buffer_resource arena_;
+	std::pmr::unsynchronized_pool_resource arenaPool_;
+
 private:
 	std::stack<State> stateStack_;
-	std::vector<Area> areas_;
+	WGA_StructureAreaIndex_CPU areas_;
 	std::vector<ComponentExpansionStatePtr> componentExpansions_;
 	std::vector<RuleExpansionStatePtr> ruleExpansions_;
 	RuleExpansionQueue queuedRuleExpansions_;
+	std::vector<QueueUndoRecord> queueUndoLog_;
 
 private:
 	std::unordered_map<std::string, int> expansionFailureReasons_;
@@ -1,5 +1,12 @@
 #include "wga_structureoutputdata_cpu.h"
 
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <tuple>
+
+#include "util/iterators.h"
+
 
 WGA_StructureOutputData_CPU::SubChunkRecord::SubChunkRecord() {
 
@@ -27,3 +34,168 @@ bool WGA_StructureOutputData_CPU::SubChunkRecord::shouldUseFlat(int addedRecordC
 
 	return false;
 }
+
+void WGA_StructureOutputData_CPU::finalize() {
+	std::vector<BlockWorldPos> origins;
+	origins.reserve(subChunkRecords.size());
+	for(const auto &rec: subChunkRecords)
+		origins.push_back(rec.first);
+
+	std::sort(origins.begin(), origins.end(), &originLess);
+
+	subChunks_.clear();
+	subChunks_.reserve(origins.size());
+	storage_.clear();
+
+	std::vector<BlockID> blocks(chunkVolume);
+	std::vector<BlockID> palette;
+	std::unordered_map<BlockID, uint8_t> paletteIndexes; ///< BlockID -> index in the palette
+
+	for(const BlockWorldPos &origin: origins) {
+		const SubChunkRecord &rec = subChunkRecords.at(origin);
+
+		// Decode the record into flat data (later associative records overwrite the earlier ones)
+		if(!rec.flatData.empty())
+			std::copy(rec.flatData.begin(), rec.flatData.end(), blocks.begin());
+		else {
+			std::fill(blocks.begin(), blocks.end(), blockID_undefined);
+			for(const auto &v: rec.associativeData)
+				blocks[v.first] = v.second;
+		}
+
+		// Collect mask and palette
+		uint64_t mask[maskWordCount] = {};
+		size_t blockCount = 0;
+		palette.clear();
+		paletteIndexes.clear();
+		bool usePalette = true;
+
+		for(int i = 0; i < chunkVolume; i++) {
+			const BlockID block = blocks[i];
+			if(block == blockID_undefined)
+				continue;
+
+			mask[i / 64] |= uint64_t(1) << (i % 64);
+			blockCount++;
+
+			if(usePalette && !paletteIndexes.contains(block)) {
+				if(palette.size() == maxPaletteSize)
+					usePalette = false;
+				else {
+					paletteIndexes[block] = static_cast<uint8_t>(palette.size());
+					palette.push_back(block);
+				}
+			}
+		}
+
+		if(!blockCount)
+			continue;
+
+		if(!usePalette)
+			palette.clear();
+
+		// Write to the storage
+		const size_t offset = storage_.size();
+		const size_t paletteBytes = palette.size() * sizeof(BlockID);
+		const size_t indexBytes = usePalette ? (palette.size() > 1 ? blockCount : 0) : blockCount * sizeof(BlockID);
+		storage_.resize(offset + maskWordCount + (paletteBytes + indexBytes + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+
+		uint64_t *maskPtr = storage_.data() + offset;
+		std::copy(mask, mask + maskWordCount, maskPtr);
+
+		uint8_t *bytes = reinterpret_cast<uint8_t *>(maskPtr + maskWordCount);
+		std::memcpy(bytes, palette.data(), paletteBytes);
+		bytes += paletteBytes;
+
+		if(!usePalette) {
+			BlockID *raw = reinterpret_cast<BlockID *>(bytes);
+			for(int i = 0; i < chunkVolume; i++) {
+				if(blocks[i] != blockID_undefined)
+					*raw++ = blocks[i];
+			}
+		}
+		else if(palette.size() > 1) {
+			for(int i = 0; i < chunkVolume; i++) {
+				if(blocks[i] != blockID_undefined)
+					*bytes++ = paletteIndexes.at(blocks[i]);
+			}
+		}
+
+		subChunks_.push_back(SubChunk{
+			.origin = origin,
+			.storageOffset = static_cast<uint32_t>(offset),
+			.blockCount = static_cast<uint16_t>(blockCount),
+			.paletteSize = static_cast<uint16_t>(palette.size()),
+		});
+	}
+
+	subChunkRecords = {};
+	storage_.shrink_to_fit();
+
+	dataSize = static_cast<int>(sizeof(WGA_StructureOutputData_CPU) + subChunks_.capacity() * sizeof(SubChunk) + storage_.capacity() * sizeof(uint64_t));
+}
+
+void WGA_StructureOutputData_CPU::mergeInto(const SubChunk &subChunk, BlockID *result) const {
+	const uint64_t *mask = storage_.data() + subChunk.storageOffset;
+	const uint8_t *bytes = reinterpret_cast<const uint8_t *>(mask + maskWordCount);
+	const BlockID *palette = reinterpret_cast<const BlockID *>(bytes);
+
+	// Calls setBlock(blockIndex, dataIndex) for each defined block, setWord(firstBlockIndex, firstDataIndex) for each fully defined 64-block run
+	const auto iterate = [mask](const auto &setBlock, const auto &setWord) {
+		size_t n = 0;
+		for(int w = 0; w < maskWordCount; w++) {
+			uint64_t bits = mask[w];
+			const int base = w * 64;
+
+			if(bits == ~uint64_t(0)) {
+				setWord(base, n);
+				n += 64;
+				continue;
+			}
+
+			while(bits) {
+				setBlock(base + std::countr_zero(bits), n++);
+				bits &= bits - 1;
+			}
+		}
+	};
+
+	if(subChunk.paletteSize == 0) {
+		iterate(
+			[result, palette](int i, size_t n) { result[i] = palette[n]; },
+			[result, palette](int i, size_t n) { std::memcpy(result + i, palette + n, 64 * sizeof(BlockID)); }
+		);
+	}
+	else if(subChunk.paletteSize == 1) {
+		const BlockID block = palette[0];
+		iterate(
+			[result, block](int i, size_t) { result[i] = block; },
+			[result, block](int i, size_t) { std::fill_n(result + i, 64, block); }
+		);
+	}
+	else {
+		const uint8_t *indexes = bytes + subChunk.paletteSize * sizeof(BlockID);
+		iterate(
+			[result, palette, indexes](int i, size_t n) { result[i] = palette[indexes[n]]; },
+			[result, palette, indexes](int i, size_t n) {
+				for(int j = 0; j < 64; j++)
+					result[i + j] = palette[indexes[n + j]];
+			}
+		);
+	}
+}
+
+bool WGA_StructureOutputData_CPU::originLess(const BlockWorldPos &a, const BlockWorldPos &b) {
+	return std::tie(a.x(), a.y(), a.z()) < std::tie(b.x(), b.y(), b.z());
+}
+
+void WGA_StructureOutputDataRecord_CPU::buildSubChunkIndex() {
+	subChunkIndex.clear();
+
+	for(const WGA_StructureOutputData_CPUPtr &struc: data) {
+		for(const WGA_StructureOutputData_CPU::SubChunk &sc: struc->subChunks())
+			subChunkIndex[sc.origin].push_back(SubChunkRef{struc.get(), &sc});
+	}
+
+	dataSizeV += static_cast<int>(subChunkIndex.size() * (sizeof(BlockWorldPos) + sizeof(std::vector<SubChunkRef>)) + iterator(subChunkIndex).mapx(x.second.size() * sizeof(SubChunkRef)).sum());
+}
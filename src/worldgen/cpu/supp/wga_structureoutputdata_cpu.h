@@ -2,12 +2,14 @@
 
 #include <vector>
 #include <unordered_map>
+#include <atomic>
 
 #include "wga_datarecord_cpu.h"
 
 class WGA_StructureOutputData_CPU {
 
 public:
+	/// Subchunk data used while generating the structure, converted to SubChunk by finalize()
 	struct SubChunkRecord {
 		SubChunkRecord();
 
@@ -18,10 +20,47 @@ public:
 		bool shouldUseFlat(int addedRecordCount);
 	};
 
+	/// Compact subchunk data in the storage: bitmask of blocks defined by the structure, followed by a palette and palette indexes of the defined blocks (in the block index order)
+	struct SubChunk {
+		BlockWorldPos origin;
+		uint32_t storageOffset; ///< In storage words
+		uint16_t blockCount;
+		uint16_t paletteSize; ///< 0 -> no palette, raw BlockIDs are stored instead of palette indexes; 1 -> no indexes stored
+	};
+
 public:
+	/// Used during the generation, emptied by finalize()
 	std::unordered_map<BlockWorldPos, SubChunkRecord> subChunkRecords;
+
+	/// Set by finalize()
 	int dataSize = 0;
 
+public:
+	/// Converts subChunkRecords into the compact representation and calculates dataSize
+	void finalize();
+
+	/// Sorted by origin
+	inline const std::vector<SubChunk> &subChunks() const {
+		return subChunks_;
+	}
+
+	/// Writes all blocks the structure defines in the subchunk to the result (chunkVolume items)
+	void mergeInto(const SubChunk &subChunk, BlockID *result) const;
+
+private:
+	static constexpr int maskWordCount = chunkVolume / 64;
+
+	/// Palette is used up to this many different blocks in the subchunk (indexes are uint8_t)
+	static constexpr size_t maxPaletteSize = 256;
+
+	static bool originLess(const BlockWorldPos &a, const BlockWorldPos &b);
+
+private:
+	std::vector<SubChunk> subChunks_;
+
+	/// Data of all subchunks in a single allocation
+	std::vector<uint64_t> storage_;
+
 };
 
 using WGA_StructureOutputData_CPUPtr = std::shared_ptr<WGA_StructureOutputData_CPU>;
@@ -29,10 +68,26 @@ using WGA_StructureOutputData_CPUPtr = std::shared_ptr<WGA_StructureOutputData_C
 
 class WGA_StructureOutputDataRecord_CPU : public WGA_DataRecord_CPU {
 
+public:
+	struct SubChunkRef {
+		const WGA_StructureOutputData_CPU *structure;
+		const WGA_StructureOutputData_CPU::SubChunk *subChunk;
+	};
+
 public:
 	std::vector<WGA_StructureOutputData_CPUPtr> data;
 	int dataSizeV = 0;
 
+	/// Subchunk origin -> subchunks of all structures that have some data in the subchunk (in the data order). Built by buildSubChunkIndex.
+	std::unordered_map<BlockWorldPos, std::vector<SubChunkRef>> subChunkIndex;
+
+	/// Set when the records around the column were scheduled for prefetching, so that it is done only once per column
+	std::atomic<bool> isNeighbourhoodPrefetched = false;
+
+public:
+	/// Builds subChunkIndex from data, call after all data is added
+	void buildSubChunkIndex();
+
 public:
 	virtual int dataSize() const override {
 		return dataSizeV;
@@ -2,16 +2,16 @@
 
 #include "util/tracyutils.h"
 
-WGA_Value_CPU::WGA_Value_CPU(WorldGenAPI_CPU &api, WGA_Value::ValueType valueType, bool isContextual, const DimensionalityFunc &dimFunc, const WGA_DataRecord_CPU::Ctor &ctor)
-	: api_(api), valueType_(valueType), isContextual_(isContextual), dimFunc_(dimFunc), ctor_(ctor) {
-	if(!isContextual_) {
+WGA_Value_CPU::WGA_Value_CPU(WorldGenAPI_CPU &api, WGA_Value::ValueType valueType, bool isContextual, const DimensionalityFunc &dimFunc, const WGA_DataRecord_CPU::Ctor &ctor, bool hasStaticDimensionality)
+	: api_(api), valueType_(valueType), isContextual_(isContextual), hasStaticDimensionality_(!isContextual || hasStaticDimensionality), dimFunc_(dimFunc), ctor_(ctor) {
+	if(hasStaticDimensionality_) {
 		cachedDimensionality_ = dimFunc_();
 		ASSERT(cachedDimensionality_ != Dimensionality::_count);
 	}
 }
 
 WGA_Value_CPU::WGA_Value_CPU(WGA_Value_CPU *proxy)
-	: WGA_Value_CPU(proxy->api_, proxy->valueType_, proxy->isContextual_, proxy->dimFunc_, nullptr) {
+	: WGA_Value_CPU(proxy->api_, proxy->valueType_, proxy->isContextual_, proxy->dimFunc_, nullptr, proxy->hasStaticDimensionality_) {
 	proxy_ = proxy;
 }
 
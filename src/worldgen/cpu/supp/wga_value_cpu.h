@@ -17,7 +17,8 @@ public:
 	using DimensionalityFunc = std::function<Dimensionality()>;
 
 public:
-	WGA_Value_CPU(WorldGenAPI_CPU &api, ValueType valueType, bool isContextual, const DimensionalityFunc &dimFunc, const WGA_DataRecord_CPU::Ctor &ctor);
+	/// hasStaticDimensionality - dimensionality of a contextual value does not depend on the structure context (is resolved on construction, same as for non-contextual values)
+	WGA_Value_CPU(WorldGenAPI_CPU &api, ValueType valueType, bool isContextual, const DimensionalityFunc &dimFunc, const WGA_DataRecord_CPU::Ctor &ctor, bool hasStaticDimensionality = false);
 	WGA_Value_CPU(WGA_Value_CPU *proxy);
 
 public:
@@ -26,16 +27,21 @@ public:
 	}
 
 	virtual inline Dimensionality dimensionality() const override {
-		if(!isContextual_)
+		if(hasStaticDimensionality_)
 			return cachedDimensionality_;
 
-		return !isContextual_ ? cachedDimensionality_ : api_.structureGen->getValueDimensionality(this);
+		return api_.structureGen->getValueDimensionality(this);
 	}
 
 	virtual inline bool isContextual() const override {
 		return isContextual_;
 	}
 
+	/// Returns true if the dimensionality is known on construction (does not depend on the structure context)
+	inline bool hasStaticDimensionality() const {
+		return hasStaticDimensionality_;
+	}
+
 	inline bool isCrossSampled(unsigned subKey) const {
 		return (crossSampledSubKeys_ >> subKey) & 1;
 	}
@@ -63,7 +69,7 @@ public:
 private:
 	WorldGenAPI_CPU &api_;
 	ValueType valueType_;
-	bool isContextual_;
+	bool isContextual_, hasStaticDimensionality_;
 	unsigned crossSampledSubKeys_ = 0;
 
 private:
@@ -32,21 +32,24 @@ public:
 	}
 
 public:
+	/// The returned reference is only valid until the next dataHandle call (the entry can get evicted from the cache)
 	inline const DataHandle &dataHandle(const BlockWorldPos &origin, WGA_DataRecord_CPU::SubKey subKey = 0) {
-		if(handleCache_.isAndSet(origin))
-			return cachedHandle_;
+		const HandleKey key{origin, subKey};
+		if(DataHandle *h = handleCache_.find(key))
+			return *h;
 
 		using Rec = WGA_StaticArrayDataRecordBase_CPU<T>;
 
 		WGA_DataRecord_CPU::Ptr rec = v->getDataRecord(origin, subKey);
 		Rec *rp = static_cast<Rec *>(rec.get());
 
-		cachedHandle_.data = rp->data;
-		cachedHandle_.handle = rec;
-		cachedHandle_.size = rp->size;
-		cachedHandle_.flag = cachedHandle_.size - 1;
+		DataHandle h;
+		h.data = rp->data;
+		h.size = rp->size;
+		h.flag = static_cast<int>(h.size) - 1;
+		h.handle = std::move(rec);
 
-		return cachedHandle_;
+		return handleCache_.insert(key, std::move(h));
 	}
 
 	inline auto constValue(WGA_DataRecord_CPU::SubKey subKey = 0) {
@@ -65,7 +68,19 @@ public:
 	WGA_Value_CPU *v = nullptr;
 
 private:
-	QuickCache<BlockWorldPos> handleCache_;
-	DataHandle cachedHandle_;
+	struct HandleKey {
+		BlockWorldPos origin;
+		WGA_DataRecord_CPU::SubKey subKey = 0;
+
+		inline bool operator ==(const HandleKey &other) const {
+			return origin == other.origin && subKey == other.subKey;
+		}
+	};
+
+	/// Number of the most recently used handles kept in the cache
+	static constexpr int handleCacheWays = 4;
+
+private:
+	AssociativeQuickCache<HandleKey, DataHandle, handleCacheWays> handleCache_;
 
 };
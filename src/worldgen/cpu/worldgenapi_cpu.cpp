@@ -2,6 +2,9 @@
 
 #include <cmath>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 
 #include "util/iterators.h"
 #include "worldgen/base/supp/wga_componentnode.h"
@@ -13,7 +16,7 @@
 
 #define WGCPUF_ARGS(T) const WGA_DataRecord_CPU::Key &key, WGA_DataHandle_CPU<WGA_Value::ValueType::T> data
 #define DIM_FUNC(D) [] { return WGA_Value::Dimensionality::D; }
-#define WGCPUF_CONST(T, expr) api->registerSymbol(new WGA_Value_CPU(*api, WGA_Value::ValueType::T, false, DIM_FUNC(DConst), wga_fillCtor<WGA_Value::ValueType::T>(DIM_FUNC(DConst), [val = (expr)] (WGCPUF_ARGS(T)) { data[0] = val; }, __FUNCTION__)))
+#define WGCPUF_CONST(T, expr) api->registerSymbol(new WGA_Value_CPU(*api, WGA_Value::ValueType::T, false, DIM_FUNC(DConst), wga_fillCtor<WGA_Value::ValueType::T>(true, DIM_FUNC(DConst), [val = (expr)] (WGCPUF_ARGS(T)) { data[0] = val; }, __FUNCTION__)))
 
 using LocalCache = std::unordered_map<WGA_DataRecord_CPU::Key, WGA_DataRecord_CPU::Ptr>;
 
@@ -27,36 +30,48 @@ WorldGenAPI_CPU::~WorldGenAPI_CPU() {
 	symbols_.clear();
 }
 
+template<typename T, typename F>
+WGA_Value *WorldGenAPI_CPU::cachedConst(ValueType type, const T &val, const F &createFunc) {
+	std::string key(1, static_cast<char>(type));
+	key.append(reinterpret_cast<const char *>(&val), sizeof(T));
+
+	WGA_Value *&r = constCache_[key];
+	if(!r)
+		r = createFunc();
+
+	return r;
+}
+
 WGA_Value *WorldGenAPI_CPU::constFloat(float val) {
 	auto api = this;
-	return WGCPUF_CONST(Float, val);
+	return cachedConst(ValueType::Float, val, [&] { return WGCPUF_CONST(Float, val); });
 }
 
 WGA_Value *WorldGenAPI_CPU::constFloat3(const V3F val) {
 	auto api = this;
-	return WGCPUF_CONST(Float3, val);
+	return cachedConst(ValueType::Float3, val, [&] { return WGCPUF_CONST(Float3, val); });
 }
 
 WGA_Value *WorldGenAPI_CPU::constBlock(BlockID val) {
 	auto api = this;
-	return WGCPUF_CONST(Block, val);
+	return cachedConst(ValueType::Block, val, [&] { return WGCPUF_CONST(Block, val); });
 }
 
 WGA_Value *WorldGenAPI_CPU::constBool(bool val) {
 	auto api = this;
-	return WGCPUF_CONST(Bool, val);
+	return cachedConst(ValueType::Bool, val, [&] { return WGCPUF_CONST(Bool, val); });
 }
 
 WGA_Value *WorldGenAPI_CPU::constRule(WGA_Rule *val) {
 	auto api = this;
 	auto v = mapSymbol(val);
-	return WGCPUF_CONST(Rule, v);
+	return cachedConst(ValueType::Rule, v, [&] { return WGCPUF_CONST(Rule, v); });
 }
 
 WGA_Value *WorldGenAPI_CPU::constComponentNode(WGA_ComponentNode *val) {
 	auto api = this;
 	auto v = mapSymbol(val);
-	return WGCPUF_CONST(ComponentNode, v);
+	return cachedConst(ValueType::ComponentNode, v, [&] { return WGCPUF_CONST(ComponentNode, v); });
 }
 
 WGA_Biome *WorldGenAPI_CPU::newBiome() {
@@ -114,6 +129,37 @@ WGA_Value *WorldGenAPI_CPU::proxy(WGA_Value *v) {
 	return registerSymbol(new WGA_Value_CPU(static_cast<WGA_Value_CPU *>(v)));
 }
 
+WGA_Value *WorldGenAPI_CPU::constFold(WGA_Value *v) {
+	if(v->isContextual() || v->dimensionality() != Dimensionality::DConst)
+		return nullptr;
+
+	switch(v->valueType()) {
+
+		case ValueType::Float:
+			return constFloat(WGA_ValueWrapper_CPU<ValueType::Float>(v).constValue());
+
+		case ValueType::Float3:
+			return constFloat3(WGA_ValueWrapper_CPU<ValueType::Float3>(v).constValue());
+
+		case ValueType::Block:
+			return constBlock(WGA_ValueWrapper_CPU<ValueType::Block>(v).constValue());
+
+		case ValueType::Bool:
+			return constBool(WGA_ValueWrapper_CPU<ValueType::Bool>(v).constValue());
+
+		case ValueType::Rule:
+			return constRule(mapToSymbol<WGA_Rule>(WGA_ValueWrapper_CPU<ValueType::Rule>(v).constValue()));
+
+		case ValueType::ComponentNode:
+			return constComponentNode(mapToSymbol<WGA_ComponentNode>(WGA_ValueWrapper_CPU<ValueType::ComponentNode>(v).constValue()));
+
+		default:
+			// There's no const constructor for the other types
+			return nullptr;
+
+	}
+}
+
 WGA_DataRecord_CPU::Ptr WorldGenAPI_CPU::getDataRecord(const WGA_DataRecord_CPU::Key &key, const WGA_DataRecord_CPU::Ctor &ctor) {
 	if(key.symbol->isContextual()) {
 		ASSERT(structureGen);
@@ -145,30 +191,39 @@ WGA_Biome &WorldGenAPI_CPU::getChunkBiome(const BlockWorldPos &origin_) {
 	const BlockWorldPos origin = BlockWorldPos(origin_.x(), origin_.y(), 0);
 
 	const auto ctor = [this](const WGA_DataRecord_CPU::Key &key) {
-		std::unordered_map<WGA_Value_CPU *, float> fields;
-		const auto getField = [&](WGA_Value_CPU *field) {
-			if(fields.contains(field))
-				return fields[field];
-
-			const float result = WGA_ValueWrapper_CPU<ValueType::Float>(field).sampleAt(key.origin);
-			fields[field] = result;
-			return result;
-		};
+		const BiomeConditionTable &table = biomeConditionTable();
+
+		// Per-thread scratch buffers so that we don't allocate on each call
+		thread_local std::vector<float> fieldValues, deviations;
+		fieldValues.resize(table.fields.size());
+		deviations.resize(table.conditionFields.size());
+
+		for(size_t i = 0; i < table.fields.size(); i++)
+			fieldValues[i] = WGA_ValueWrapper_CPU<ValueType::Float>(table.fields[i]).sampleAt(key.origin);
+
+		// Deviations of all conditions in a single loop; d for d <= 1, d^4 otherwise
+		const size_t conditionCount = table.conditionFields.size();
+		for(size_t i = 0; i < conditionCount; i++) {
+			const float d = std::abs(table.conditionMeans[i] - fieldValues[table.conditionFields[i]]) / table.conditionDeviations[i];
+			const float d2 = d * d;
+			deviations[i] = d > 1 ? d2 * d2 : d;
+		}
 
 		float bestDeviation = std::numeric_limits<float>::max();
 		WGA_Biome *bestBiome = nullptr;
 
-		ASSERT(biomes_.size());
-		for(WGA_Biome *biome: biomes_) {
-			float deviation = biome->conditions().size() * -0.2f; // Give some advantage to biomes with many conditions
-			for(const WGA_Biome::Condition &c: biome->conditions()) {
-				const float fieldVal = getField(static_cast<WGA_Value_CPU *>(c.param));
-				const float d = abs(c.mean - fieldVal) / c.deviation;
-				deviation += pow(d, d > 1 ? 4 : 1);
-			}
+		uint32_t conditionsBegin = 0;
+		for(size_t i = 0; i < biomes_.size(); i++) {
+			const uint32_t conditionsEnd = table.biomeConditionsEnd[i];
+
+			float deviation = table.biomeBiases[i];
+			for(uint32_t j = conditionsBegin; j < conditionsEnd; j++)
+				deviation += deviations[j];
+
+			conditionsBegin = conditionsEnd;
 
 			if(deviation < bestDeviation) {
-				bestBiome = biome;
+				bestBiome = biomes_[i];
 				bestDeviation = deviation;
 			}
 		}
@@ -185,6 +240,45 @@ WGA_Biome &WorldGenAPI_CPU::getChunkBiome(const BlockWorldPos &origin_) {
 	return *r.data;
 }
 
+const WorldGenAPI_CPU::BiomeConditionTable &WorldGenAPI_CPU::biomeConditionTable() {
+	// Acquire pairs with the release below, so the table contents are visible to the threads that see the flag set
+	if(biomeConditionTableReady_.load(std::memory_order_acquire))
+		return biomeConditionTable_;
+
+	std::unique_lock _ml(biomeConditionTableMutex_);
+	if(biomeConditionTableReady_.load(std::memory_order_relaxed))
+		return biomeConditionTable_;
+
+	ASSERT(biomes_.size());
+
+	BiomeConditionTable &t = biomeConditionTable_;
+	std::unordered_map<WGA_Value_CPU *, uint32_t> fieldIndexes;
+
+	for(WGA_Biome *biome: biomes_) {
+		t.biomeBiases.push_back(biome->conditions().size() * -0.2f); // Give some advantage to biomes with many conditions
+
+		for(const WGA_Biome::Condition &c: biome->conditions()) {
+			WGA_Value_CPU *field = static_cast<WGA_Value_CPU *>(c.param);
+
+			auto it = fieldIndexes.find(field);
+			if(it == fieldIndexes.end()) {
+				it = fieldIndexes.emplace(field, static_cast<uint32_t>(t.fields.size())).first;
+				t.fields.push_back(field);
+			}
+
+			t.conditionFields.push_back(it->second);
+			t.conditionMeans.push_back(c.mean);
+			t.conditionDeviations.push_back(c.deviation);
+		}
+
+		t.biomeConditionsEnd.push_back(static_cast<uint32_t>(t.conditionFields.size()));
+	}
+
+	biomeConditionTableReady_.store(true, std::memory_order_release);
+
+	return biomeConditionTable_;
+}
+
 std::shared_ptr<WGA_DataRecordT_CPU<WGA_BiomeData_CPU>> WorldGenAPI_CPU::getBiomeData(const BlockWorldPos &origin_) {
 	using Rec = WGA_DataRecordT_CPU<WGA_BiomeData_CPU>;
 	const BlockWorldPos origin = BlockWorldPos(origin_.x(), origin_.y(), 0);
@@ -203,10 +297,128 @@ std::shared_ptr<WGA_DataRecordT_CPU<WGA_BiomeData_CPU>> WorldGenAPI_CPU::getBiom
 	return r;
 }
 
+std::shared_ptr<WGA_DataRecordT_CPU<WGA_BiomeGridCell_CPU>> WorldGenAPI_CPU::getBiomeGridCell(const Vector2I &gridCellOrigin) {
+	using Rec = WGA_DataRecordT_CPU<WGA_BiomeGridCell_CPU>;
+
+	const auto ctor = [this](const WGA_DataRecord_CPU::Key &key) {
+		auto r = new Rec();
+
+		r->data.calculateFor(*this, key.origin.xy());
+
+		return WGA_DataRecord_CPU::Ptr(r);
+	};
+
+	auto rec = getDataRecord(WGA_DataRecord_CPU::Key(&biomeGridCellSymbol_, BlockWorldPos(gridCellOrigin.x(), gridCellOrigin.y(), 0), 0), ctor);
+	return std::static_pointer_cast<Rec>(rec);
+}
+
 void WorldGenAPI_CPU::reportCacheHitRate() {
 	dataCache_.reportHitRate();
 }
 
+void WorldGenAPI_CPU::parallelFor(size_t count, const std::function<void(size_t)> &func) {
+	// The calling thread is usually one of the workers, the rest of them can help
+	const size_t helperCount = std::min<size_t>(count - 1, workerCount_ > 1 ? workerCount_ - 1 : 0);
+
+	if(!jobScheduler_ || count < 2 || !helperCount) {
+		for(size_t i = 0; i < count; i++)
+			func(i);
+
+		return;
+	}
+
+	struct State {
+		const std::function<void(size_t)> *func;
+		size_t count;
+
+		std::atomic<size_t> nextIx = 0;
+		size_t doneCount = 0;
+		std::exception_ptr exception;
+
+		std::mutex mutex;
+		std::condition_variable doneCondition;
+	};
+
+	auto state = std::make_shared<State>();
+	state->func = &func;
+	state->count = count;
+
+	// Workers pick up indexes until there are none left. Helpers that get to run after all the work was taken just exit without touching func (which might not exist anymore)
+	const auto work = [](State &s) {
+		while(true) {
+			const size_t i = s.nextIx++;
+			if(i >= s.count)
+				return;
+
+			std::exception_ptr exception;
+			try {
+				(*s.func)(i);
+			}
+			catch(...) {
+				exception = std::current_exception();
+			}
+
+			std::unique_lock _ml(s.mutex);
+			if(exception && !s.exception)
+				s.exception = exception;
+
+			if(++s.doneCount == s.count)
+				s.doneCondition.notify_all();
+		}
+	};
+
+	for(size_t i = 0; i < helperCount; i++)
+		jobScheduler_([state, work] { work(*state); }, JobPriority::Urgent);
+
+	work(*state);
+
+	std::unique_lock _ml(state->mutex);
+	state->doneCondition.wait(_ml, [&] { return state->doneCount == count; });
+
+	if(state->exception)
+		std::rethrow_exception(state->exception);
+}
+
+void WorldGenAPI_CPU::prefetchDataRecord(const WGA_DataRecord_CPU::Key &key, const WGA_DataRecord_CPU::Ctor &ctor) {
+	if(!jobScheduler_)
+		return;
+
+	{
+		std::unique_lock _ml(prefetchMutex_);
+		if(!prefetchedKeys_.insert(key).second)
+			return;
+
+		prefetchedKeysOrder_.push_back(key);
+		if(prefetchedKeysOrder_.size() > maxPrefetchedKeys) {
+			prefetchedKeys_.erase(prefetchedKeysOrder_.front());
+			prefetchedKeysOrder_.pop_front();
+		}
+	}
+
+	// The scheduler can drop idle jobs without running them (full queue) -> forget the key then, so that it can be prefetched again.
+	// Shared by all copies of the job, destroyed with the last one.
+	struct DropGuard {
+		WorldGenAPI_CPU *api;
+		WGA_DataRecord_CPU::Key key;
+		bool isRun = false;
+
+		~DropGuard() {
+			if(isRun)
+				return;
+
+			std::unique_lock _ml(api->prefetchMutex_);
+			api->prefetchedKeys_.erase(key);
+		}
+	};
+
+	auto guard = std::make_shared<DropGuard>(this, key);
+	jobScheduler_([this, guard, ctor] {
+		ZoneScopedN("prefetchDataRecord");
+		guard->isRun = true;
+		getDataRecord(guard->key, ctor);
+	}, JobPriority::Idle);
+}
+
 WGA_Value *WorldGenAPI_CPU::grammarSymbolParam(WGA_GrammarSymbol *sym, const std::string &name, WGA_Value::ValueType type, WGA_Value *defaultValue) {
 	auto v = std::make_shared<WGA_Value *>();
 	const auto dimFunc = [v]() {
@@ -1,8 +1,14 @@
 #pragma once
 
 #include <vector>
+#include <functional>
+#include <mutex>
+#include <atomic>
+#include <deque>
+#include <unordered_set>
 
 #include "worldgen/base/worldgenapi.h"
+#include "util/tracyutils.h"
 
 #include "supp/wga_datacache_cpu.h"
 #include "supp/wga_valuerecs_cpu.h"
@@ -14,6 +20,14 @@ public:
 	using Dimensionality = WGA_Value::Dimensionality;
 	using ValueType = WGA_Value::ValueType;
 
+	enum class JobPriority {
+		Urgent, ///< Job that other jobs are possibly waiting for, should be run as soon as possible
+		Idle ///< Job that should only be run when there is nothing else to do; can be dropped
+	};
+
+	using Job = std::function<void()>;
+	using JobScheduler = std::function<void(Job &&job, JobPriority priority)>;
+
 public:
 	virtual ~WorldGenAPI_CPU();
 
@@ -42,11 +56,13 @@ public:
 	virtual WGA_Value *function(FunctionID function, const FunctionArgs &args) override;
 	virtual WGA_Value *proxy(WGA_Value *v) override;
 	virtual WGA_Value *grammarSymbolParam(WGA_GrammarSymbol *sym, const std::string &name, WGA_Value::ValueType type, WGA_Value *defaultValue) override;
+	virtual WGA_Value *constFold(WGA_Value *v) override;
 
 public:
 	WGA_DataRecord_CPU::Ptr getDataRecord(const WGA_DataRecord_CPU::Key &key, const WGA_DataRecord_CPU::Ctor &ctor);
 	WGA_Biome &getChunkBiome(const BlockWorldPos &origin);
 	std::shared_ptr<WGA_DataRecordT_CPU<WGA_BiomeData_CPU> > getBiomeData(const BlockWorldPos &origin);
+	std::shared_ptr<WGA_DataRecordT_CPU<WGA_BiomeGridCell_CPU> > getBiomeGridCell(const Vector2I &gridCellOrigin);
 
 	/// Creates thread local cache for data (saves some mutex collisions)
 	static void createLocalCache();
@@ -54,6 +70,27 @@ public:
 
 	void reportCacheHitRate();
 
+	inline WGA_DataCache_CPU &dataCache() {
+		return dataCache_;
+	}
+
+public:
+	/// Sets function that is used for running jobs on worker threads (the worker threads have to have the local cache created).
+	/// If not set, all work is done on the calling thread. workerCount is the number of threads running the jobs (limits the number of parallelFor helpers).
+	inline void setJobScheduler(const JobScheduler &scheduler, size_t workerCount) {
+		jobScheduler_ = scheduler;
+		workerCount_ = workerCount;
+	}
+
+	/// Calls func(i) for i in [0, count), distributing the calls among the workers.
+	/// The calling thread also takes part, so this never blocks on the workers being busy. Rethrows the first exception thrown by func.
+	void parallelFor(size_t count, const std::function<void(size_t)> &func);
+
+	/// Schedules generating the data record on an idle worker, so that it is already in the cache when requested.
+	/// Each key is scheduled at most once (tracking a bounded number of recently prefetched keys, keys of jobs dropped by the scheduler can be scheduled again). Does nothing if there's no job scheduler.
+	/// The ctor is called from a different thread, it must not reference any local data of the caller.
+	void prefetchDataRecord(const WGA_DataRecord_CPU::Key &key, const WGA_DataRecord_CPU::Ctor &ctor);
+
 	template<typename T>
 	inline T *mapToSymbol(WGA_SymbolID_CPU id) {
 		ASSERT(idSymbolMapping_.contains(id));
@@ -75,16 +112,53 @@ private:
 private:
 	WGA_SymbolID_CPU mapSymbol(WGA_Symbol *sym);
 
+	/// Returns already existing const value of the same type and value or creates a new one using #createFunc
+	template<typename T, typename F>
+	WGA_Value *cachedConst(ValueType type, const T &val, const F &createFunc);
+
 private:
-	WGA_Symbol chunkBiomeSymbol_, biomeDataSymbol_;
+	/// Biome conditions of all biomes flattened for getChunkBiome
+	struct BiomeConditionTable {
+		/// Distinct fields used in the conditions, each is sampled only once per chunk
+		std::vector<WGA_Value_CPU *> fields;
+
+		/// Conditions of all biomes (SoA), grouped by biome in the biomes_ order
+		std::vector<uint32_t> conditionFields; ///< Index to fields
+		std::vector<float> conditionMeans, conditionDeviations;
+
+		/// Conditions of biome i are in range [biomeConditionsEnd[i - 1], biomeConditionsEnd[i])
+		std::vector<uint32_t> biomeConditionsEnd;
+
+		/// Initial deviation of each biome
+		std::vector<float> biomeBiases;
+	};
+
+	/// Builds the table on the first call (after that, no biomes can be added)
+	const BiomeConditionTable &biomeConditionTable();
+
+private:
+	WGA_Symbol chunkBiomeSymbol_, biomeDataSymbol_, biomeGridCellSymbol_;
+
+	BiomeConditionTable biomeConditionTable_;
+	std::atomic<bool> biomeConditionTableReady_ = false;
+	TracyLockable(std::mutex, biomeConditionTableMutex_);
 
 private:
 	std::unordered_map<WGA_Symbol *, WGA_SymbolID_CPU> symbolIDMapping_;
 	std::unordered_map<WGA_SymbolID_CPU, WGA_Symbol *> idSymbolMapping_;
 	std::vector<WGA_Symbol *> symbols_;
 	std::vector<WGA_Biome *> biomes_;
+	std::unordered_map<std::string, WGA_Value *> constCache_; ///< Type + raw value bytes -> const value
 
 private:
 	WGA_DataCache_CPU dataCache_;
+	JobScheduler jobScheduler_;
+	size_t workerCount_ = 0;
+
+private:
+	static constexpr size_t maxPrefetchedKeys = 8192;
+	std::mutex prefetchMutex_;
+	std::unordered_set<WGA_DataRecord_CPU::Key> prefetchedKeys_;
+	std::deque<WGA_DataRecord_CPU::Key> prefetchedKeysOrder_; ///< For removing the oldest keys from prefetchedKeys_
 
 };